@@ -473,6 +473,39 @@ public abstract class broadcast implements java.io.Serializable {
              case 13879:
                 return unmarshal_connect(in);
 
+             case -22613:
+                return unmarshal_frame_format(in);
+
+             case 12722:
+                return unmarshal_ack(in);
+
+             case -18847:
+                return unmarshal_pixel_format(in);
+
+             case -30158:
+                return unmarshal_chunking(in);
+
+             case 4689:
+                return unmarshal_capabilities(in);
+
+             case -31327:
+                return unmarshal_tune(in);
+
+             case 10890:
+                return unmarshal_slicing(in);
+
+             case 10497:
+                return unmarshal_progressive(in);
+
+             case 5885:
+                return unmarshal_foveation(in);
+
+             case 12054:
+                return unmarshal_stereo(in);
+
+             case 17549:
+                return unmarshal_pose(in);
+
              default:
                 throw new java.io.IOException("invalid message for 'broadcast' protocol");
             }
@@ -504,6 +537,202 @@ public abstract class broadcast implements java.io.Serializable {
             marshal(out, v.win_caption);
         }
 
+        static void marshal(java.io.DataOutputStream out, frame_format v) throws java.io.IOException
+        {
+            out.writeByte(81);
+            out.writeByte(4);
+
+            out.writeByte(18);
+            out.writeByte(-53);
+            out.writeByte(100);
+            marshal(out, v.codec);
+
+            out.writeByte(18);
+            out.writeByte(54);
+            out.writeByte(-78);
+            marshal(out, v.quality);
+        }
+
+        static void marshal(java.io.DataOutputStream out, ack v) throws java.io.IOException
+        {
+            out.writeByte(81);
+            out.writeByte(2);
+
+            out.writeByte(18);
+            out.writeByte(-104);
+            out.writeByte(-68);
+            marshal(out, v.timestamp_ns);
+        }
+
+        static void marshal(java.io.DataOutputStream out, pixel_format v) throws java.io.IOException
+        {
+            out.writeByte(81);
+            out.writeByte(2);
+
+            out.writeByte(18);
+            out.writeByte(-71);
+            out.writeByte(42);
+            marshal(out, v.format);
+        }
+
+        static void marshal(java.io.DataOutputStream out, chunking v) throws java.io.IOException
+        {
+            out.writeByte(81);
+            out.writeByte(2);
+
+            out.writeByte(18);
+            out.writeByte(20);
+            out.writeByte(35);
+            marshal(out, v.chunk_size);
+        }
+
+        static void marshal(java.io.DataOutputStream out, capabilities v) throws java.io.IOException
+        {
+            out.writeByte(81);
+            out.writeByte(8);
+
+            out.writeByte(18);
+            out.writeByte(-82);
+            out.writeByte(-127);
+            marshal(out, v.codecs);
+
+            out.writeByte(18);
+            out.writeByte(13);
+            out.writeByte(73);
+            marshal(out, v.pixel_formats);
+
+            out.writeByte(18);
+            out.writeByte(-112);
+            out.writeByte(115);
+            marshal(out, v.max_fps);
+
+            out.writeByte(18);
+            out.writeByte(-106);
+            out.writeByte(-34);
+            marshal(out, v.decoder_threads);
+        }
+
+        static void marshal(java.io.DataOutputStream out, tune v) throws java.io.IOException
+        {
+            out.writeByte(81);
+            out.writeByte(8);
+
+            out.writeByte(18);
+            out.writeByte(-112);
+            out.writeByte(115);
+            marshal(out, v.max_fps);
+
+            out.writeByte(18);
+            out.writeByte(122);
+            out.writeByte(-21);
+            marshal(out, v.scale);
+
+            out.writeByte(18);
+            out.writeByte(-53);
+            out.writeByte(100);
+            marshal(out, v.codec);
+
+            out.writeByte(18);
+            out.writeByte(54);
+            out.writeByte(-78);
+            marshal(out, v.quality);
+        }
+
+        static void marshal(java.io.DataOutputStream out, slicing v) throws java.io.IOException
+        {
+            out.writeByte(81);
+            out.writeByte(2);
+
+            out.writeByte(18);
+            out.writeByte(124);
+            out.writeByte(27);
+            marshal(out, v.slices);
+        }
+
+        static void marshal(java.io.DataOutputStream out, progressive v) throws java.io.IOException
+        {
+            out.writeByte(81);
+            out.writeByte(2);
+
+            out.writeByte(18);
+            out.writeByte(52);
+            out.writeByte(108);
+            marshal(out, v.preview_scale);
+        }
+
+        static void marshal(java.io.DataOutputStream out, foveation v) throws java.io.IOException
+        {
+            out.writeByte(81);
+            out.writeByte(6);
+
+            out.writeByte(18);
+            out.writeByte(-25);
+            out.writeByte(101);
+            marshal(out, v.eyes);
+
+            out.writeByte(18);
+            out.writeByte(-74);
+            out.writeByte(100);
+            marshal(out, v.fovea_percent);
+
+            out.writeByte(18);
+            out.writeByte(60);
+            out.writeByte(-52);
+            marshal(out, v.periphery_scale);
+        }
+
+        static void marshal(java.io.DataOutputStream out, stereo v) throws java.io.IOException
+        {
+            out.writeByte(81);
+            out.writeByte(2);
+
+            out.writeByte(18);
+            out.writeByte(4);
+            out.writeByte(-107);
+            marshal(out, v.layout);
+        }
+
+        static void marshal(java.io.DataOutputStream out, pose v) throws java.io.IOException
+        {
+            out.writeByte(81);
+            out.writeByte(14);
+
+            out.writeByte(18);
+            out.writeByte(-104);
+            out.writeByte(-68);
+            marshal(out, v.timestamp_ns);
+
+            out.writeByte(18);
+            out.writeByte(-90);
+            out.writeByte(68);
+            marshal(out, v.yaw);
+
+            out.writeByte(18);
+            out.writeByte(-73);
+            out.writeByte(-97);
+            marshal(out, v.pitch);
+
+            out.writeByte(18);
+            out.writeByte(-122);
+            out.writeByte(77);
+            marshal(out, v.fov_x);
+
+            out.writeByte(18);
+            out.writeByte(96);
+            out.writeByte(-119);
+            marshal(out, v.fov_y);
+
+            out.writeByte(18);
+            out.writeByte(79);
+            out.writeByte(113);
+            marshal(out, v.view_w);
+
+            out.writeByte(18);
+            out.writeByte(-62);
+            out.writeByte(-69);
+            marshal(out, v.view_h);
+        }
+
         static connect unmarshal_connect(java.io.DataInputStream in) throws java.io.IOException
         {
             final int flds = readLength(in, 0x50);
@@ -555,96 +784,119 @@ public abstract class broadcast implements java.io.Serializable {
             return d;
         }
 
-        public static broadcast.Request unmarshal(java.nio.ByteBuffer in) throws java.io.IOException
+        static frame_format unmarshal_frame_format(java.io.DataInputStream in) throws java.io.IOException
         {
-            byte[] hdr = new byte[3];
+            final int flds = readLength(in, 0x50);
 
-            in.get(hdr);
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
 
-            if (!(new java.lang.String(hdr)).equals("SDD"))
-                throw new java.io.IOException("invalid SDD message format");
+            java.util.BitSet flg = new java.util.BitSet(2);
+            frame_format d = new frame_format();
 
-            if (in.get() != 2)
-                throw new java.io.IOException("invalid SDD version number");
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case -13468: //int32 codec
+                {
+                    flg.set(0);
+                    d.codec = unmarshal_int32(in);
+                }
+                break;
 
-            if (readLength(in, 0x50) != 3)
-                throw new java.io.IOException("invalid start of message for the 'broadcast' protocol");
+             case 14002: //int32 quality
+                {
+                    flg.set(1);
+                    d.quality = unmarshal_int32(in);
+                }
+                break;
 
-            if (unmarshal_int32(in) != -1241126304)
-                throw new java.io.IOException("unknown protocol");
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
 
-            switch (unmarshal_int16(in)) {
-             case 13879:
-                return unmarshal_connect(in);
+            if (flg.cardinality() != 2)
+                throw new java.io.IOException("missing required field(s)");
 
-             default:
-                throw new java.io.IOException("invalid message for 'broadcast' protocol");
-            }
+            return d;
         }
 
-        static void marshal(java.nio.ByteBuffer out, connect v) throws java.io.IOException
+        static ack unmarshal_ack(java.io.DataInputStream in) throws java.io.IOException
         {
-            out.put((byte)81);
-            out.put((byte)8);
+            final int flds = readLength(in, 0x50);
 
-            out.put((byte)18);
-            out.put((byte)26);
-            out.put((byte)-81);
-            marshal(out, v.version_client);
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
 
-            out.put((byte)18);
-            out.put((byte)-126);
-            out.put((byte)-7);
-            marshal(out, v.screen_width);
+            java.util.BitSet flg = new java.util.BitSet(1);
+            ack d = new ack();
 
-            out.put((byte)18);
-            out.put((byte)4);
-            out.put((byte)110);
-            marshal(out, v.screen_height);
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case -26436: //int64 timestamp_ns
+                {
+                    flg.set(0);
+                    d.timestamp_ns = unmarshal_int64(in);
+                }
+                break;
 
-            out.put((byte)18);
-            out.put((byte)82);
-            out.put((byte)-59);
-            marshal(out, v.win_caption);
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 1)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
         }
 
-        static connect unmarshal_connect(java.nio.ByteBuffer in) throws java.io.IOException
+        static pixel_format unmarshal_pixel_format(java.io.DataInputStream in) throws java.io.IOException
         {
             final int flds = readLength(in, 0x50);
 
             if (flds < 0)
                 throw new java.io.IOException("invalid array size");
 
-            java.util.BitSet flg = new java.util.BitSet(4);
-            connect d = new connect();
+            java.util.BitSet flg = new java.util.BitSet(1);
+            pixel_format d = new pixel_format();
 
             for (int ii = 0; ii < flds; ii += 2) {
                 switch (unmarshal_int16(in)) {
-             case 6831: //int32 version_client
+             case -18134: //int32 format
                 {
                     flg.set(0);
-                    d.version_client = unmarshal_int32(in);
+                    d.format = unmarshal_int32(in);
                 }
                 break;
 
-             case -32007: //int32 screen_width
-                {
-                    flg.set(1);
-                    d.screen_width = unmarshal_int32(in);
+                 default:
+                    throw new java.io.IOException("unknown field in message");
                 }
-                break;
+            }
 
-             case 1134: //int32 screen_height
-                {
-                    flg.set(2);
-                    d.screen_height = unmarshal_int32(in);
-                }
-                break;
+            if (flg.cardinality() != 1)
+                throw new java.io.IOException("missing required field(s)");
 
-             case 21189: //string win_caption
+            return d;
+        }
+
+        static chunking unmarshal_chunking(java.io.DataInputStream in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
+
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
+
+            java.util.BitSet flg = new java.util.BitSet(1);
+            chunking d = new chunking();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case 5155: //int32 chunk_size
                 {
-                    flg.set(3);
-                    d.win_caption = unmarshal_string(in);
+                    flg.set(0);
+                    d.chunk_size = unmarshal_int32(in);
                 }
                 break;
 
@@ -653,262 +905,100 @@ public abstract class broadcast implements java.io.Serializable {
                 }
             }
 
-            if (flg.cardinality() != 4)
+            if (flg.cardinality() != 1)
                 throw new java.io.IOException("missing required field(s)");
 
             return d;
         }
 
-        // Interface for receiving all messages.
+        static capabilities unmarshal_capabilities(java.io.DataInputStream in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
 
-        public interface Receiver {
-            void handle(connect m);
-        }
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
 
-        public abstract void deliverTo(Receiver r);
+            java.util.BitSet flg = new java.util.BitSet(4);
+            capabilities d = new capabilities();
 
-        public static class connect extends Request {
-            static final long serialVersionUID = 1588514567L;
-            public int version_client;
-            public int screen_width;
-            public int screen_height;
-            public java.lang.String win_caption;
-
-            public connect()
-            {
-                version_client = 0;
-                screen_width = 0;
-                screen_height = 0;
-                win_caption = "";
-            }
-
-            public void deliverTo(Receiver r)
-            {
-                r.handle(this);
-            }
-
-            void marshal(java.io.DataOutputStream out) throws java.io.IOException
-            {
-                out.writeByte(0x51);
-                out.writeByte(3);
-
-                // Protocol name
-
-                out.writeByte(20);
-                out.writeByte(-74);
-                out.writeByte(5);
-                out.writeByte(-22);
-                out.writeByte(96);
-
-                // Message name
-
-                out.writeByte(18);
-                out.writeByte(54);
-                out.writeByte(55);
-
-                // Message
-
-                marshal(out, this);
-            }
-
-            void _marshal(java.nio.ByteBuffer out) throws java.io.IOException
-            {
-                out.put((byte)0x51);
-                out.put((byte)3);
-
-                // Protocol name
-
-                out.put((byte)20);
-                out.put((byte)-74);
-                out.put((byte)5);
-                out.put((byte)-22);
-                out.put((byte)96);
-
-                // Message name
-
-                out.put((byte)18);
-                out.put((byte)54);
-                out.put((byte)55);
-
-                // Message
-
-                marshal(out, this);
-            }
-
-            public boolean equals(Object _o)
-            {
-                if (_o instanceof connect) {
-                    connect o = (connect) _o;
-
-                    return version_client == o.version_client && 
-                        screen_width == o.screen_width && 
-                        screen_height == o.screen_height && 
-                        broadcast.equals(win_caption, o.win_caption);
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case -20863: //int32 codecs
+                {
+                    flg.set(0);
+                    d.codecs = unmarshal_int32(in);
                 }
+                break;
 
-                return false;
-            }
-
-            public int hashCode()
-            {
-                return version_client + 
-                        screen_width + 
-                        screen_height + 
-                        win_caption.hashCode();
-            }
-
-            public java.lang.String toString()
-            {
-                StringBuilder buf = new StringBuilder("Request connect {\n");
-
-                buf.append("    int32 version_client = ");
-                buf.append(version_client);
-                buf.append(";\n");
-
-                buf.append("    int32 screen_width = ");
-                buf.append(screen_width);
-                buf.append(";\n");
-
-                buf.append("    int32 screen_height = ");
-                buf.append(screen_height);
-                buf.append(";\n");
-
-                buf.append("    string win_caption = ");
-                if (win_caption != null)
-                    buf.append('"');
-                buf.append(win_caption);
-                if (win_caption != null)
-                    buf.append('"');
-                buf.append(";\n");
-
-                buf.append("}\n");
-                return buf.toString();
-            }
-        }
-
-    }
-
-    //
-    // Reply types
-    //
-    public abstract static class Reply extends broadcast {
-
-        public static broadcast.Reply unmarshal(java.io.InputStream is) throws java.io.IOException
-        {
-            java.io.DataInputStream in = new java.io.DataInputStream(is);
-
-            byte[] hdr = new byte[3];
-            if (in.read(hdr) != hdr.length)
-                throw new java.io.IOException("invalid SDD message format");
-
-            if (!(new java.lang.String(hdr)).equals("SDD"))
-                throw new java.io.IOException("invalid SDD message format");
-
-            if (in.readByte() != 2)
-                throw new java.io.IOException("invalid SDD version number");
-
-            if (readLength(in, 0x50) != 3)
-                throw new java.io.IOException("invalid start of message for the 'broadcast' protocol");
-
-            if (unmarshal_int32(in) != -1241126304)
-                throw new java.io.IOException("unknown protocol");
-
-            switch (unmarshal_int16(in)) {
-             case -11031:
-                return unmarshal_Error(in);
+             case 3401: //int32 pixel_formats
+                {
+                    flg.set(1);
+                    d.pixel_formats = unmarshal_int32(in);
+                }
+                break;
 
-             case -32638:
-                return unmarshal_connected(in);
+             case -28557: //int32 max_fps
+                {
+                    flg.set(2);
+                    d.max_fps = unmarshal_int32(in);
+                }
+                break;
 
-             case -32373:
-                return unmarshal_frame(in);
+             case -26914: //int32 decoder_threads
+                {
+                    flg.set(3);
+                    d.decoder_threads = unmarshal_int32(in);
+                }
+                break;
 
-             default:
-                throw new java.io.IOException("invalid message for 'broadcast' protocol");
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
             }
-        }
-
-        static void marshal(java.io.DataOutputStream out, Error v) throws java.io.IOException
-        {
-            out.writeByte(81);
-            out.writeByte(4);
-
-            out.writeByte(18);
-            out.writeByte(103);
-            out.writeByte(-108);
-            marshal(out, v.code);
-
-            out.writeByte(18);
-            out.writeByte(49);
-            out.writeByte(2);
-            marshal(out, v.message);
-        }
-
-        static void marshal(java.io.DataOutputStream out, connected v) throws java.io.IOException
-        {
-            out.writeByte(81);
-            out.writeByte(2);
-
-            out.writeByte(18);
-            out.writeByte(-16);
-            out.writeByte(-49);
-            marshal(out, v.server_version);
-        }
-
-        static void marshal(java.io.DataOutputStream out, frame v) throws java.io.IOException
-        {
-            out.writeByte(81);
-            out.writeByte(10);
-
-            out.writeByte(18);
-            out.writeByte(-104);
-            out.writeByte(-68);
-            marshal(out, v.timestamp_ns);
-
-            out.writeByte(18);
-            out.writeByte(104);
-            out.writeByte(-42);
-            marshal(out, v.flags);
-
-            out.writeByte(18);
-            out.writeByte(1);
-            out.writeByte(-122);
-            marshal(out, v.w);
 
-            out.writeByte(18);
-            out.writeByte(-61);
-            out.writeByte(-112);
-            marshal(out, v.h);
+            if (flg.cardinality() != 4)
+                throw new java.io.IOException("missing required field(s)");
 
-            out.writeByte(18);
-            out.writeByte(127);
-            out.writeByte(56);
-            marshal(out, v.data);
+            return d;
         }
 
-        static Error unmarshal_Error(java.io.DataInputStream in) throws java.io.IOException
+        static tune unmarshal_tune(java.io.DataInputStream in) throws java.io.IOException
         {
             final int flds = readLength(in, 0x50);
 
             if (flds < 0)
                 throw new java.io.IOException("invalid array size");
 
-            java.util.BitSet flg = new java.util.BitSet(2);
-            Error d = new Error();
+            java.util.BitSet flg = new java.util.BitSet(4);
+            tune d = new tune();
 
             for (int ii = 0; ii < flds; ii += 2) {
                 switch (unmarshal_int16(in)) {
-             case 26516: //int32 code
+             case -28557: //int32 max_fps
                 {
                     flg.set(0);
-                    d.code = unmarshal_int32(in);
+                    d.max_fps = unmarshal_int32(in);
                 }
                 break;
 
-             case 12546: //string message
+             case 31467: //int32 scale
                 {
                     flg.set(1);
-                    d.message = unmarshal_string(in);
+                    d.scale = unmarshal_int32(in);
+                }
+                break;
+
+             case -13468: //int32 codec
+                {
+                    flg.set(2);
+                    d.codec = unmarshal_int32(in);
+                }
+                break;
+
+             case 14002: //int32 quality
+                {
+                    flg.set(3);
+                    d.quality = unmarshal_int32(in);
                 }
                 break;
 
@@ -917,13 +1007,13 @@ public abstract class broadcast implements java.io.Serializable {
                 }
             }
 
-            if (flg.cardinality() != 2)
+            if (flg.cardinality() != 4)
                 throw new java.io.IOException("missing required field(s)");
 
             return d;
         }
 
-        static connected unmarshal_connected(java.io.DataInputStream in) throws java.io.IOException
+        static slicing unmarshal_slicing(java.io.DataInputStream in) throws java.io.IOException
         {
             final int flds = readLength(in, 0x50);
 
@@ -931,14 +1021,14 @@ public abstract class broadcast implements java.io.Serializable {
                 throw new java.io.IOException("invalid array size");
 
             java.util.BitSet flg = new java.util.BitSet(1);
-            connected d = new connected();
+            slicing d = new slicing();
 
             for (int ii = 0; ii < flds; ii += 2) {
                 switch (unmarshal_int16(in)) {
-             case -3889: //int32 server_version
+             case 31771: //int32 slices
                 {
                     flg.set(0);
-                    d.server_version = unmarshal_int32(in);
+                    d.slices = unmarshal_int32(in);
                 }
                 break;
 
@@ -953,15 +1043,119 @@ public abstract class broadcast implements java.io.Serializable {
             return d;
         }
 
-        static frame unmarshal_frame(java.io.DataInputStream in) throws java.io.IOException
+        static progressive unmarshal_progressive(java.io.DataInputStream in) throws java.io.IOException
         {
             final int flds = readLength(in, 0x50);
 
             if (flds < 0)
                 throw new java.io.IOException("invalid array size");
 
-            java.util.BitSet flg = new java.util.BitSet(5);
-            frame d = new frame();
+            java.util.BitSet flg = new java.util.BitSet(1);
+            progressive d = new progressive();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case 13420: //int32 preview_scale
+                {
+                    flg.set(0);
+                    d.preview_scale = unmarshal_int32(in);
+                }
+                break;
+
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 1)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
+        }
+
+        static foveation unmarshal_foveation(java.io.DataInputStream in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
+
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
+
+            java.util.BitSet flg = new java.util.BitSet(3);
+            foveation d = new foveation();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case -6299: //int32 eyes
+                {
+                    flg.set(0);
+                    d.eyes = unmarshal_int32(in);
+                }
+                break;
+
+             case -18844: //int32 fovea_percent
+                {
+                    flg.set(1);
+                    d.fovea_percent = unmarshal_int32(in);
+                }
+                break;
+
+             case 15564: //int32 periphery_scale
+                {
+                    flg.set(2);
+                    d.periphery_scale = unmarshal_int32(in);
+                }
+                break;
+
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 3)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
+        }
+
+        static stereo unmarshal_stereo(java.io.DataInputStream in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
+
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
+
+            java.util.BitSet flg = new java.util.BitSet(1);
+            stereo d = new stereo();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case 1173: //int32 layout
+                {
+                    flg.set(0);
+                    d.layout = unmarshal_int32(in);
+                }
+                break;
+
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 1)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
+        }
+
+        static pose unmarshal_pose(java.io.DataInputStream in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
+
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
+
+            java.util.BitSet flg = new java.util.BitSet(7);
+            pose d = new pose();
 
             for (int ii = 0; ii < flds; ii += 2) {
                 switch (unmarshal_int16(in)) {
@@ -972,31 +1166,45 @@ public abstract class broadcast implements java.io.Serializable {
                 }
                 break;
 
-             case 26838: //int32 flags
+             case -22972: //int32 yaw
                 {
                     flg.set(1);
-                    d.flags = unmarshal_int32(in);
+                    d.yaw = unmarshal_int32(in);
                 }
                 break;
 
-             case 390: //int32 w
+             case -18529: //int32 pitch
                 {
                     flg.set(2);
-                    d.w = unmarshal_int32(in);
+                    d.pitch = unmarshal_int32(in);
                 }
                 break;
 
-             case -15472: //int32 h
+             case -31155: //int32 fov_x
                 {
                     flg.set(3);
-                    d.h = unmarshal_int32(in);
+                    d.fov_x = unmarshal_int32(in);
                 }
                 break;
 
-             case 32568: //binary data
+             case 24713: //int32 fov_y
                 {
                     flg.set(4);
-                    d.data = unmarshal_binary(in);
+                    d.fov_y = unmarshal_int32(in);
+                }
+                break;
+
+             case 20337: //int32 view_w
+                {
+                    flg.set(5);
+                    d.view_w = unmarshal_int32(in);
+                }
+                break;
+
+             case -15685: //int32 view_h
+                {
+                    flg.set(6);
+                    d.view_h = unmarshal_int32(in);
                 }
                 break;
 
@@ -1005,13 +1213,13 @@ public abstract class broadcast implements java.io.Serializable {
                 }
             }
 
-            if (flg.cardinality() != 5)
+            if (flg.cardinality() != 7)
                 throw new java.io.IOException("missing required field(s)");
 
             return d;
         }
 
-        public static broadcast.Reply unmarshal(java.nio.ByteBuffer in) throws java.io.IOException
+        public static broadcast.Request unmarshal(java.nio.ByteBuffer in) throws java.io.IOException
         {
             byte[] hdr = new byte[3];
 
@@ -1030,51 +1238,232 @@ public abstract class broadcast implements java.io.Serializable {
                 throw new java.io.IOException("unknown protocol");
 
             switch (unmarshal_int16(in)) {
-             case -11031:
-                return unmarshal_Error(in);
+             case 13879:
+                return unmarshal_connect(in);
 
-             case -32638:
-                return unmarshal_connected(in);
+             case -22613:
+                return unmarshal_frame_format(in);
 
-             case -32373:
-                return unmarshal_frame(in);
+             case 12722:
+                return unmarshal_ack(in);
+
+             case -18847:
+                return unmarshal_pixel_format(in);
+
+             case -30158:
+                return unmarshal_chunking(in);
+
+             case 4689:
+                return unmarshal_capabilities(in);
+
+             case -31327:
+                return unmarshal_tune(in);
+
+             case 10890:
+                return unmarshal_slicing(in);
+
+             case 10497:
+                return unmarshal_progressive(in);
+
+             case 5885:
+                return unmarshal_foveation(in);
+
+             case 12054:
+                return unmarshal_stereo(in);
+
+             case 17549:
+                return unmarshal_pose(in);
 
              default:
                 throw new java.io.IOException("invalid message for 'broadcast' protocol");
             }
         }
 
-        static void marshal(java.nio.ByteBuffer out, Error v) throws java.io.IOException
+        static void marshal(java.nio.ByteBuffer out, connect v) throws java.io.IOException
+        {
+            out.put((byte)81);
+            out.put((byte)8);
+
+            out.put((byte)18);
+            out.put((byte)26);
+            out.put((byte)-81);
+            marshal(out, v.version_client);
+
+            out.put((byte)18);
+            out.put((byte)-126);
+            out.put((byte)-7);
+            marshal(out, v.screen_width);
+
+            out.put((byte)18);
+            out.put((byte)4);
+            out.put((byte)110);
+            marshal(out, v.screen_height);
+
+            out.put((byte)18);
+            out.put((byte)82);
+            out.put((byte)-59);
+            marshal(out, v.win_caption);
+        }
+
+        static void marshal(java.nio.ByteBuffer out, frame_format v) throws java.io.IOException
         {
             out.put((byte)81);
             out.put((byte)4);
 
             out.put((byte)18);
-            out.put((byte)103);
-            out.put((byte)-108);
-            marshal(out, v.code);
+            out.put((byte)-53);
+            out.put((byte)100);
+            marshal(out, v.codec);
 
             out.put((byte)18);
-            out.put((byte)49);
+            out.put((byte)54);
+            out.put((byte)-78);
+            marshal(out, v.quality);
+        }
+
+        static void marshal(java.nio.ByteBuffer out, ack v) throws java.io.IOException
+        {
+            out.put((byte)81);
             out.put((byte)2);
-            marshal(out, v.message);
+
+            out.put((byte)18);
+            out.put((byte)-104);
+            out.put((byte)-68);
+            marshal(out, v.timestamp_ns);
         }
 
-        static void marshal(java.nio.ByteBuffer out, connected v) throws java.io.IOException
+        static void marshal(java.nio.ByteBuffer out, pixel_format v) throws java.io.IOException
         {
             out.put((byte)81);
             out.put((byte)2);
 
             out.put((byte)18);
-            out.put((byte)-16);
-            out.put((byte)-49);
-            marshal(out, v.server_version);
+            out.put((byte)-71);
+            out.put((byte)42);
+            marshal(out, v.format);
         }
 
-        static void marshal(java.nio.ByteBuffer out, frame v) throws java.io.IOException
+        static void marshal(java.nio.ByteBuffer out, chunking v) throws java.io.IOException
         {
             out.put((byte)81);
-            out.put((byte)10);
+            out.put((byte)2);
+
+            out.put((byte)18);
+            out.put((byte)20);
+            out.put((byte)35);
+            marshal(out, v.chunk_size);
+        }
+
+        static void marshal(java.nio.ByteBuffer out, capabilities v) throws java.io.IOException
+        {
+            out.put((byte)81);
+            out.put((byte)8);
+
+            out.put((byte)18);
+            out.put((byte)-82);
+            out.put((byte)-127);
+            marshal(out, v.codecs);
+
+            out.put((byte)18);
+            out.put((byte)13);
+            out.put((byte)73);
+            marshal(out, v.pixel_formats);
+
+            out.put((byte)18);
+            out.put((byte)-112);
+            out.put((byte)115);
+            marshal(out, v.max_fps);
+
+            out.put((byte)18);
+            out.put((byte)-106);
+            out.put((byte)-34);
+            marshal(out, v.decoder_threads);
+        }
+
+        static void marshal(java.nio.ByteBuffer out, tune v) throws java.io.IOException
+        {
+            out.put((byte)81);
+            out.put((byte)8);
+
+            out.put((byte)18);
+            out.put((byte)-112);
+            out.put((byte)115);
+            marshal(out, v.max_fps);
+
+            out.put((byte)18);
+            out.put((byte)122);
+            out.put((byte)-21);
+            marshal(out, v.scale);
+
+            out.put((byte)18);
+            out.put((byte)-53);
+            out.put((byte)100);
+            marshal(out, v.codec);
+
+            out.put((byte)18);
+            out.put((byte)54);
+            out.put((byte)-78);
+            marshal(out, v.quality);
+        }
+
+        static void marshal(java.nio.ByteBuffer out, slicing v) throws java.io.IOException
+        {
+            out.put((byte)81);
+            out.put((byte)2);
+
+            out.put((byte)18);
+            out.put((byte)124);
+            out.put((byte)27);
+            marshal(out, v.slices);
+        }
+
+        static void marshal(java.nio.ByteBuffer out, progressive v) throws java.io.IOException
+        {
+            out.put((byte)81);
+            out.put((byte)2);
+
+            out.put((byte)18);
+            out.put((byte)52);
+            out.put((byte)108);
+            marshal(out, v.preview_scale);
+        }
+
+        static void marshal(java.nio.ByteBuffer out, foveation v) throws java.io.IOException
+        {
+            out.put((byte)81);
+            out.put((byte)6);
+
+            out.put((byte)18);
+            out.put((byte)-25);
+            out.put((byte)101);
+            marshal(out, v.eyes);
+
+            out.put((byte)18);
+            out.put((byte)-74);
+            out.put((byte)100);
+            marshal(out, v.fovea_percent);
+
+            out.put((byte)18);
+            out.put((byte)60);
+            out.put((byte)-52);
+            marshal(out, v.periphery_scale);
+        }
+
+        static void marshal(java.nio.ByteBuffer out, stereo v) throws java.io.IOException
+        {
+            out.put((byte)81);
+            out.put((byte)2);
+
+            out.put((byte)18);
+            out.put((byte)4);
+            out.put((byte)-107);
+            marshal(out, v.layout);
+        }
+
+        static void marshal(java.nio.ByteBuffer out, pose v) throws java.io.IOException
+        {
+            out.put((byte)81);
+            out.put((byte)14);
 
             out.put((byte)18);
             out.put((byte)-104);
@@ -1082,170 +1471,3767 @@ public abstract class broadcast implements java.io.Serializable {
             marshal(out, v.timestamp_ns);
 
             out.put((byte)18);
-            out.put((byte)104);
-            out.put((byte)-42);
-            marshal(out, v.flags);
+            out.put((byte)-90);
+            out.put((byte)68);
+            marshal(out, v.yaw);
+
+            out.put((byte)18);
+            out.put((byte)-73);
+            out.put((byte)-97);
+            marshal(out, v.pitch);
 
             out.put((byte)18);
-            out.put((byte)1);
             out.put((byte)-122);
-            marshal(out, v.w);
+            out.put((byte)77);
+            marshal(out, v.fov_x);
 
             out.put((byte)18);
-            out.put((byte)-61);
-            out.put((byte)-112);
-            marshal(out, v.h);
+            out.put((byte)96);
+            out.put((byte)-119);
+            marshal(out, v.fov_y);
 
             out.put((byte)18);
-            out.put((byte)127);
-            out.put((byte)56);
-            marshal(out, v.data);
+            out.put((byte)79);
+            out.put((byte)113);
+            marshal(out, v.view_w);
+
+            out.put((byte)18);
+            out.put((byte)-62);
+            out.put((byte)-69);
+            marshal(out, v.view_h);
         }
 
-        static Error unmarshal_Error(java.nio.ByteBuffer in) throws java.io.IOException
+        static connect unmarshal_connect(java.nio.ByteBuffer in) throws java.io.IOException
         {
             final int flds = readLength(in, 0x50);
 
             if (flds < 0)
                 throw new java.io.IOException("invalid array size");
 
-            java.util.BitSet flg = new java.util.BitSet(2);
-            Error d = new Error();
+            java.util.BitSet flg = new java.util.BitSet(4);
+            connect d = new connect();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case 6831: //int32 version_client
+                {
+                    flg.set(0);
+                    d.version_client = unmarshal_int32(in);
+                }
+                break;
+
+             case -32007: //int32 screen_width
+                {
+                    flg.set(1);
+                    d.screen_width = unmarshal_int32(in);
+                }
+                break;
+
+             case 1134: //int32 screen_height
+                {
+                    flg.set(2);
+                    d.screen_height = unmarshal_int32(in);
+                }
+                break;
+
+             case 21189: //string win_caption
+                {
+                    flg.set(3);
+                    d.win_caption = unmarshal_string(in);
+                }
+                break;
+
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 4)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
+        }
+
+        static frame_format unmarshal_frame_format(java.nio.ByteBuffer in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
+
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
+
+            java.util.BitSet flg = new java.util.BitSet(2);
+            frame_format d = new frame_format();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case -13468: //int32 codec
+                {
+                    flg.set(0);
+                    d.codec = unmarshal_int32(in);
+                }
+                break;
+
+             case 14002: //int32 quality
+                {
+                    flg.set(1);
+                    d.quality = unmarshal_int32(in);
+                }
+                break;
+
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 2)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
+        }
+
+        static ack unmarshal_ack(java.nio.ByteBuffer in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
+
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
+
+            java.util.BitSet flg = new java.util.BitSet(1);
+            ack d = new ack();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case -26436: //int64 timestamp_ns
+                {
+                    flg.set(0);
+                    d.timestamp_ns = unmarshal_int64(in);
+                }
+                break;
+
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 1)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
+        }
+
+        static pixel_format unmarshal_pixel_format(java.nio.ByteBuffer in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
+
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
+
+            java.util.BitSet flg = new java.util.BitSet(1);
+            pixel_format d = new pixel_format();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case -18134: //int32 format
+                {
+                    flg.set(0);
+                    d.format = unmarshal_int32(in);
+                }
+                break;
+
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 1)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
+        }
+
+        static chunking unmarshal_chunking(java.nio.ByteBuffer in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
+
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
+
+            java.util.BitSet flg = new java.util.BitSet(1);
+            chunking d = new chunking();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case 5155: //int32 chunk_size
+                {
+                    flg.set(0);
+                    d.chunk_size = unmarshal_int32(in);
+                }
+                break;
+
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 1)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
+        }
+
+        static capabilities unmarshal_capabilities(java.nio.ByteBuffer in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
+
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
+
+            java.util.BitSet flg = new java.util.BitSet(4);
+            capabilities d = new capabilities();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case -20863: //int32 codecs
+                {
+                    flg.set(0);
+                    d.codecs = unmarshal_int32(in);
+                }
+                break;
+
+             case 3401: //int32 pixel_formats
+                {
+                    flg.set(1);
+                    d.pixel_formats = unmarshal_int32(in);
+                }
+                break;
+
+             case -28557: //int32 max_fps
+                {
+                    flg.set(2);
+                    d.max_fps = unmarshal_int32(in);
+                }
+                break;
+
+             case -26914: //int32 decoder_threads
+                {
+                    flg.set(3);
+                    d.decoder_threads = unmarshal_int32(in);
+                }
+                break;
+
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 4)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
+        }
+
+        static tune unmarshal_tune(java.nio.ByteBuffer in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
+
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
+
+            java.util.BitSet flg = new java.util.BitSet(4);
+            tune d = new tune();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case -28557: //int32 max_fps
+                {
+                    flg.set(0);
+                    d.max_fps = unmarshal_int32(in);
+                }
+                break;
+
+             case 31467: //int32 scale
+                {
+                    flg.set(1);
+                    d.scale = unmarshal_int32(in);
+                }
+                break;
+
+             case -13468: //int32 codec
+                {
+                    flg.set(2);
+                    d.codec = unmarshal_int32(in);
+                }
+                break;
+
+             case 14002: //int32 quality
+                {
+                    flg.set(3);
+                    d.quality = unmarshal_int32(in);
+                }
+                break;
+
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 4)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
+        }
+
+        static slicing unmarshal_slicing(java.nio.ByteBuffer in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
+
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
+
+            java.util.BitSet flg = new java.util.BitSet(1);
+            slicing d = new slicing();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case 31771: //int32 slices
+                {
+                    flg.set(0);
+                    d.slices = unmarshal_int32(in);
+                }
+                break;
+
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 1)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
+        }
+
+        static progressive unmarshal_progressive(java.nio.ByteBuffer in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
+
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
+
+            java.util.BitSet flg = new java.util.BitSet(1);
+            progressive d = new progressive();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case 13420: //int32 preview_scale
+                {
+                    flg.set(0);
+                    d.preview_scale = unmarshal_int32(in);
+                }
+                break;
+
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 1)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
+        }
+
+        static foveation unmarshal_foveation(java.nio.ByteBuffer in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
+
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
+
+            java.util.BitSet flg = new java.util.BitSet(3);
+            foveation d = new foveation();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case -6299: //int32 eyes
+                {
+                    flg.set(0);
+                    d.eyes = unmarshal_int32(in);
+                }
+                break;
+
+             case -18844: //int32 fovea_percent
+                {
+                    flg.set(1);
+                    d.fovea_percent = unmarshal_int32(in);
+                }
+                break;
+
+             case 15564: //int32 periphery_scale
+                {
+                    flg.set(2);
+                    d.periphery_scale = unmarshal_int32(in);
+                }
+                break;
+
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 3)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
+        }
+
+        static stereo unmarshal_stereo(java.nio.ByteBuffer in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
+
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
+
+            java.util.BitSet flg = new java.util.BitSet(1);
+            stereo d = new stereo();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case 1173: //int32 layout
+                {
+                    flg.set(0);
+                    d.layout = unmarshal_int32(in);
+                }
+                break;
+
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 1)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
+        }
+
+        static pose unmarshal_pose(java.nio.ByteBuffer in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
+
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
+
+            java.util.BitSet flg = new java.util.BitSet(7);
+            pose d = new pose();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case -26436: //int64 timestamp_ns
+                {
+                    flg.set(0);
+                    d.timestamp_ns = unmarshal_int64(in);
+                }
+                break;
+
+             case -22972: //int32 yaw
+                {
+                    flg.set(1);
+                    d.yaw = unmarshal_int32(in);
+                }
+                break;
+
+             case -18529: //int32 pitch
+                {
+                    flg.set(2);
+                    d.pitch = unmarshal_int32(in);
+                }
+                break;
+
+             case -31155: //int32 fov_x
+                {
+                    flg.set(3);
+                    d.fov_x = unmarshal_int32(in);
+                }
+                break;
+
+             case 24713: //int32 fov_y
+                {
+                    flg.set(4);
+                    d.fov_y = unmarshal_int32(in);
+                }
+                break;
+
+             case 20337: //int32 view_w
+                {
+                    flg.set(5);
+                    d.view_w = unmarshal_int32(in);
+                }
+                break;
+
+             case -15685: //int32 view_h
+                {
+                    flg.set(6);
+                    d.view_h = unmarshal_int32(in);
+                }
+                break;
+
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 7)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
+        }
+
+        // Interface for receiving all messages.
+
+        public interface Receiver {
+            void handle(connect m);
+            void handle(frame_format m);
+            void handle(ack m);
+            void handle(pixel_format m);
+            void handle(chunking m);
+            void handle(capabilities m);
+            void handle(tune m);
+            void handle(slicing m);
+            void handle(progressive m);
+            void handle(foveation m);
+            void handle(stereo m);
+            void handle(pose m);
+        }
+
+        public abstract void deliverTo(Receiver r);
+
+        public static class connect extends Request {
+            static final long serialVersionUID = 1588514567L;
+            public int version_client;
+            public int screen_width;
+            public int screen_height;
+            public java.lang.String win_caption;
+
+            public connect()
+            {
+                version_client = 0;
+                screen_width = 0;
+                screen_height = 0;
+                win_caption = "";
+            }
+
+            public void deliverTo(Receiver r)
+            {
+                r.handle(this);
+            }
+
+            void marshal(java.io.DataOutputStream out) throws java.io.IOException
+            {
+                out.writeByte(0x51);
+                out.writeByte(3);
+
+                // Protocol name
+
+                out.writeByte(20);
+                out.writeByte(-74);
+                out.writeByte(5);
+                out.writeByte(-22);
+                out.writeByte(96);
+
+                // Message name
+
+                out.writeByte(18);
+                out.writeByte(54);
+                out.writeByte(55);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            void _marshal(java.nio.ByteBuffer out) throws java.io.IOException
+            {
+                out.put((byte)0x51);
+                out.put((byte)3);
+
+                // Protocol name
+
+                out.put((byte)20);
+                out.put((byte)-74);
+                out.put((byte)5);
+                out.put((byte)-22);
+                out.put((byte)96);
+
+                // Message name
+
+                out.put((byte)18);
+                out.put((byte)54);
+                out.put((byte)55);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            public boolean equals(Object _o)
+            {
+                if (_o instanceof connect) {
+                    connect o = (connect) _o;
+
+                    return version_client == o.version_client && 
+                        screen_width == o.screen_width && 
+                        screen_height == o.screen_height && 
+                        broadcast.equals(win_caption, o.win_caption);
+                }
+
+                return false;
+            }
+
+            public int hashCode()
+            {
+                return version_client + 
+                        screen_width + 
+                        screen_height + 
+                        win_caption.hashCode();
+            }
+
+            public java.lang.String toString()
+            {
+                StringBuilder buf = new StringBuilder("Request connect {\n");
+
+                buf.append("    int32 version_client = ");
+                buf.append(version_client);
+                buf.append(";\n");
+
+                buf.append("    int32 screen_width = ");
+                buf.append(screen_width);
+                buf.append(";\n");
+
+                buf.append("    int32 screen_height = ");
+                buf.append(screen_height);
+                buf.append(";\n");
+
+                buf.append("    string win_caption = ");
+                if (win_caption != null)
+                    buf.append('"');
+                buf.append(win_caption);
+                if (win_caption != null)
+                    buf.append('"');
+                buf.append(";\n");
+
+                buf.append("}\n");
+                return buf.toString();
+            }
+        }
+
+        public static class frame_format extends Request {
+            static final long serialVersionUID = 959628384L;
+            public int codec;
+            public int quality;
+
+            public frame_format()
+            {
+                codec = 0;
+                quality = 0;
+            }
+
+            public void deliverTo(Receiver r)
+            {
+                r.handle(this);
+            }
+
+            void marshal(java.io.DataOutputStream out) throws java.io.IOException
+            {
+                out.writeByte(0x51);
+                out.writeByte(3);
+
+                // Protocol name
+
+                out.writeByte(20);
+                out.writeByte(-74);
+                out.writeByte(5);
+                out.writeByte(-22);
+                out.writeByte(96);
+
+                // Message name
+
+                out.writeByte(18);
+                out.writeByte(-89);
+                out.writeByte(-85);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            void _marshal(java.nio.ByteBuffer out) throws java.io.IOException
+            {
+                out.put((byte)0x51);
+                out.put((byte)3);
+
+                // Protocol name
+
+                out.put((byte)20);
+                out.put((byte)-74);
+                out.put((byte)5);
+                out.put((byte)-22);
+                out.put((byte)96);
+
+                // Message name
+
+                out.put((byte)18);
+                out.put((byte)-89);
+                out.put((byte)-85);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            public boolean equals(Object _o)
+            {
+                if (_o instanceof frame_format) {
+                    frame_format o = (frame_format) _o;
+
+                    return codec == o.codec && 
+                        quality == o.quality;
+                }
+
+                return false;
+            }
+
+            public int hashCode()
+            {
+                return codec + 
+                        quality;
+            }
+
+            public java.lang.String toString()
+            {
+                StringBuilder buf = new StringBuilder("Request frame_format {\n");
+
+                buf.append("    int32 codec = ");
+                buf.append(codec);
+                buf.append(";\n");
+
+                buf.append("    int32 quality = ");
+                buf.append(quality);
+                buf.append(";\n");
+
+                buf.append("}\n");
+                return buf.toString();
+            }
+        }
+
+        public static class ack extends Request {
+            static final long serialVersionUID = -1353973590L;
+            public long timestamp_ns;
+
+            public ack()
+            {
+                timestamp_ns = 0;
+            }
+
+            public void deliverTo(Receiver r)
+            {
+                r.handle(this);
+            }
+
+            void marshal(java.io.DataOutputStream out) throws java.io.IOException
+            {
+                out.writeByte(0x51);
+                out.writeByte(3);
+
+                // Protocol name
+
+                out.writeByte(20);
+                out.writeByte(-74);
+                out.writeByte(5);
+                out.writeByte(-22);
+                out.writeByte(96);
+
+                // Message name
+
+                out.writeByte(18);
+                out.writeByte(49);
+                out.writeByte(-78);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            void _marshal(java.nio.ByteBuffer out) throws java.io.IOException
+            {
+                out.put((byte)0x51);
+                out.put((byte)3);
+
+                // Protocol name
+
+                out.put((byte)20);
+                out.put((byte)-74);
+                out.put((byte)5);
+                out.put((byte)-22);
+                out.put((byte)96);
+
+                // Message name
+
+                out.put((byte)18);
+                out.put((byte)49);
+                out.put((byte)-78);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            public boolean equals(Object _o)
+            {
+                if (_o instanceof ack) {
+                    ack o = (ack) _o;
+
+                    return timestamp_ns == o.timestamp_ns;
+                }
+
+                return false;
+            }
+
+            public int hashCode()
+            {
+                return (new Long(timestamp_ns).hashCode());
+            }
+
+            public java.lang.String toString()
+            {
+                StringBuilder buf = new StringBuilder("Request ack {\n");
+
+                buf.append("    int64 timestamp_ns = ");
+                buf.append(timestamp_ns);
+                buf.append(";\n");
+
+                buf.append("}\n");
+                return buf.toString();
+            }
+        }
+
+        public static class pixel_format extends Request {
+            static final long serialVersionUID = 1120188431L;
+            public int format;
+
+            public pixel_format()
+            {
+                format = 0;
+            }
+
+            public void deliverTo(Receiver r)
+            {
+                r.handle(this);
+            }
+
+            void marshal(java.io.DataOutputStream out) throws java.io.IOException
+            {
+                out.writeByte(0x51);
+                out.writeByte(3);
+
+                // Protocol name
+
+                out.writeByte(20);
+                out.writeByte(-74);
+                out.writeByte(5);
+                out.writeByte(-22);
+                out.writeByte(96);
+
+                // Message name
+
+                out.writeByte(18);
+                out.writeByte(-74);
+                out.writeByte(97);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            void _marshal(java.nio.ByteBuffer out) throws java.io.IOException
+            {
+                out.put((byte)0x51);
+                out.put((byte)3);
+
+                // Protocol name
+
+                out.put((byte)20);
+                out.put((byte)-74);
+                out.put((byte)5);
+                out.put((byte)-22);
+                out.put((byte)96);
+
+                // Message name
+
+                out.put((byte)18);
+                out.put((byte)-74);
+                out.put((byte)97);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            public boolean equals(Object _o)
+            {
+                if (_o instanceof pixel_format) {
+                    pixel_format o = (pixel_format) _o;
+
+                    return format == o.format;
+                }
+
+                return false;
+            }
+
+            public int hashCode()
+            {
+                return format;
+            }
+
+            public java.lang.String toString()
+            {
+                StringBuilder buf = new StringBuilder("Request pixel_format {\n");
+
+                buf.append("    int32 format = ");
+                buf.append(format);
+                buf.append(";\n");
+
+                buf.append("}\n");
+                return buf.toString();
+            }
+        }
+
+        public static class chunking extends Request {
+            static final long serialVersionUID = -1885102637L;
+            public int chunk_size;
+
+            public chunking()
+            {
+                chunk_size = 0;
+            }
+
+            public void deliverTo(Receiver r)
+            {
+                r.handle(this);
+            }
+
+            void marshal(java.io.DataOutputStream out) throws java.io.IOException
+            {
+                out.writeByte(0x51);
+                out.writeByte(3);
+
+                // Protocol name
+
+                out.writeByte(20);
+                out.writeByte(-74);
+                out.writeByte(5);
+                out.writeByte(-22);
+                out.writeByte(96);
+
+                // Message name
+
+                out.writeByte(18);
+                out.writeByte(-118);
+                out.writeByte(50);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            void _marshal(java.nio.ByteBuffer out) throws java.io.IOException
+            {
+                out.put((byte)0x51);
+                out.put((byte)3);
+
+                // Protocol name
+
+                out.put((byte)20);
+                out.put((byte)-74);
+                out.put((byte)5);
+                out.put((byte)-22);
+                out.put((byte)96);
+
+                // Message name
+
+                out.put((byte)18);
+                out.put((byte)-118);
+                out.put((byte)50);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            public boolean equals(Object _o)
+            {
+                if (_o instanceof chunking) {
+                    chunking o = (chunking) _o;
+
+                    return chunk_size == o.chunk_size;
+                }
+
+                return false;
+            }
+
+            public int hashCode()
+            {
+                return chunk_size;
+            }
+
+            public java.lang.String toString()
+            {
+                StringBuilder buf = new StringBuilder("Request chunking {\n");
+
+                buf.append("    int32 chunk_size = ");
+                buf.append(chunk_size);
+                buf.append(";\n");
+
+                buf.append("}\n");
+                return buf.toString();
+            }
+        }
+
+        public static class capabilities extends Request {
+            static final long serialVersionUID = 509308459L;
+            public int codecs;
+            public int pixel_formats;
+            public int max_fps;
+            public int decoder_threads;
+
+            public capabilities()
+            {
+                codecs = 0;
+                pixel_formats = 0;
+                max_fps = 0;
+                decoder_threads = 0;
+            }
+
+            public void deliverTo(Receiver r)
+            {
+                r.handle(this);
+            }
+
+            void marshal(java.io.DataOutputStream out) throws java.io.IOException
+            {
+                out.writeByte(0x51);
+                out.writeByte(3);
+
+                // Protocol name
+
+                out.writeByte(20);
+                out.writeByte(-74);
+                out.writeByte(5);
+                out.writeByte(-22);
+                out.writeByte(96);
+
+                // Message name
+
+                out.writeByte(18);
+                out.writeByte(18);
+                out.writeByte(81);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            void _marshal(java.nio.ByteBuffer out) throws java.io.IOException
+            {
+                out.put((byte)0x51);
+                out.put((byte)3);
+
+                // Protocol name
+
+                out.put((byte)20);
+                out.put((byte)-74);
+                out.put((byte)5);
+                out.put((byte)-22);
+                out.put((byte)96);
+
+                // Message name
+
+                out.put((byte)18);
+                out.put((byte)18);
+                out.put((byte)81);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            public boolean equals(Object _o)
+            {
+                if (_o instanceof capabilities) {
+                    capabilities o = (capabilities) _o;
+
+                    return codecs == o.codecs && 
+                        pixel_formats == o.pixel_formats && 
+                        max_fps == o.max_fps && 
+                        decoder_threads == o.decoder_threads;
+                }
+
+                return false;
+            }
+
+            public int hashCode()
+            {
+                return codecs + 
+                        pixel_formats + 
+                        max_fps + 
+                        decoder_threads;
+            }
+
+            public java.lang.String toString()
+            {
+                StringBuilder buf = new StringBuilder("Request capabilities {\n");
+
+                buf.append("    int32 codecs = ");
+                buf.append(codecs);
+                buf.append(";\n");
+
+                buf.append("    int32 pixel_formats = ");
+                buf.append(pixel_formats);
+                buf.append(";\n");
+
+                buf.append("    int32 max_fps = ");
+                buf.append(max_fps);
+                buf.append(";\n");
+
+                buf.append("    int32 decoder_threads = ");
+                buf.append(decoder_threads);
+                buf.append(";\n");
+
+                buf.append("}\n");
+                return buf.toString();
+            }
+        }
+
+        public static class tune extends Request {
+            static final long serialVersionUID = -1921039704L;
+            public int max_fps;
+            public int scale;
+            public int codec;
+            public int quality;
+
+            public tune()
+            {
+                max_fps = 0;
+                scale = 0;
+                codec = 0;
+                quality = 0;
+            }
+
+            public void deliverTo(Receiver r)
+            {
+                r.handle(this);
+            }
+
+            void marshal(java.io.DataOutputStream out) throws java.io.IOException
+            {
+                out.writeByte(0x51);
+                out.writeByte(3);
+
+                // Protocol name
+
+                out.writeByte(20);
+                out.writeByte(-74);
+                out.writeByte(5);
+                out.writeByte(-22);
+                out.writeByte(96);
+
+                // Message name
+
+                out.writeByte(18);
+                out.writeByte(-123);
+                out.writeByte(-95);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            void _marshal(java.nio.ByteBuffer out) throws java.io.IOException
+            {
+                out.put((byte)0x51);
+                out.put((byte)3);
+
+                // Protocol name
+
+                out.put((byte)20);
+                out.put((byte)-74);
+                out.put((byte)5);
+                out.put((byte)-22);
+                out.put((byte)96);
+
+                // Message name
+
+                out.put((byte)18);
+                out.put((byte)-123);
+                out.put((byte)-95);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            public boolean equals(Object _o)
+            {
+                if (_o instanceof tune) {
+                    tune o = (tune) _o;
+
+                    return max_fps == o.max_fps && 
+                        scale == o.scale && 
+                        codec == o.codec && 
+                        quality == o.quality;
+                }
+
+                return false;
+            }
+
+            public int hashCode()
+            {
+                return max_fps + 
+                        scale + 
+                        codec + 
+                        quality;
+            }
+
+            public java.lang.String toString()
+            {
+                StringBuilder buf = new StringBuilder("Request tune {\n");
+
+                buf.append("    int32 max_fps = ");
+                buf.append(max_fps);
+                buf.append(";\n");
+
+                buf.append("    int32 scale = ");
+                buf.append(scale);
+                buf.append(";\n");
+
+                buf.append("    int32 codec = ");
+                buf.append(codec);
+                buf.append(";\n");
+
+                buf.append("    int32 quality = ");
+                buf.append(quality);
+                buf.append(";\n");
+
+                buf.append("}\n");
+                return buf.toString();
+            }
+        }
+
+        public static class slicing extends Request {
+            static final long serialVersionUID = -457515440L;
+            public int slices;
+
+            public slicing()
+            {
+                slices = 0;
+            }
+
+            public void deliverTo(Receiver r)
+            {
+                r.handle(this);
+            }
+
+            void marshal(java.io.DataOutputStream out) throws java.io.IOException
+            {
+                out.writeByte(0x51);
+                out.writeByte(3);
+
+                // Protocol name
+
+                out.writeByte(20);
+                out.writeByte(-74);
+                out.writeByte(5);
+                out.writeByte(-22);
+                out.writeByte(96);
+
+                // Message name
+
+                out.writeByte(18);
+                out.writeByte(42);
+                out.writeByte(-118);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            void _marshal(java.nio.ByteBuffer out) throws java.io.IOException
+            {
+                out.put((byte)0x51);
+                out.put((byte)3);
+
+                // Protocol name
+
+                out.put((byte)20);
+                out.put((byte)-74);
+                out.put((byte)5);
+                out.put((byte)-22);
+                out.put((byte)96);
+
+                // Message name
+
+                out.put((byte)18);
+                out.put((byte)42);
+                out.put((byte)-118);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            public boolean equals(Object _o)
+            {
+                if (_o instanceof slicing) {
+                    slicing o = (slicing) _o;
+
+                    return slices == o.slices;
+                }
+
+                return false;
+            }
+
+            public int hashCode()
+            {
+                return slices;
+            }
+
+            public java.lang.String toString()
+            {
+                StringBuilder buf = new StringBuilder("Request slicing {\n");
+
+                buf.append("    int32 slices = ");
+                buf.append(slices);
+                buf.append(";\n");
+
+                buf.append("}\n");
+                return buf.toString();
+            }
+        }
+
+        public static class progressive extends Request {
+            static final long serialVersionUID = -208235433L;
+            public int preview_scale;
+
+            public progressive()
+            {
+                preview_scale = 0;
+            }
+
+            public void deliverTo(Receiver r)
+            {
+                r.handle(this);
+            }
+
+            void marshal(java.io.DataOutputStream out) throws java.io.IOException
+            {
+                out.writeByte(0x51);
+                out.writeByte(3);
+
+                // Protocol name
+
+                out.writeByte(20);
+                out.writeByte(-74);
+                out.writeByte(5);
+                out.writeByte(-22);
+                out.writeByte(96);
+
+                // Message name
+
+                out.writeByte(18);
+                out.writeByte(41);
+                out.writeByte(1);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            void _marshal(java.nio.ByteBuffer out) throws java.io.IOException
+            {
+                out.put((byte)0x51);
+                out.put((byte)3);
+
+                // Protocol name
+
+                out.put((byte)20);
+                out.put((byte)-74);
+                out.put((byte)5);
+                out.put((byte)-22);
+                out.put((byte)96);
+
+                // Message name
+
+                out.put((byte)18);
+                out.put((byte)41);
+                out.put((byte)1);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            public boolean equals(Object _o)
+            {
+                if (_o instanceof progressive) {
+                    progressive o = (progressive) _o;
+
+                    return preview_scale == o.preview_scale;
+                }
+
+                return false;
+            }
+
+            public int hashCode()
+            {
+                return preview_scale;
+            }
+
+            public java.lang.String toString()
+            {
+                StringBuilder buf = new StringBuilder("Request progressive {\n");
+
+                buf.append("    int32 preview_scale = ");
+                buf.append(preview_scale);
+                buf.append(";\n");
+
+                buf.append("}\n");
+                return buf.toString();
+            }
+        }
+
+        public static class foveation extends Request {
+            static final long serialVersionUID = -1944115802L;
+            public int eyes;
+            public int fovea_percent;
+            public int periphery_scale;
+
+            public foveation()
+            {
+                eyes = 0;
+                fovea_percent = 0;
+                periphery_scale = 0;
+            }
+
+            public void deliverTo(Receiver r)
+            {
+                r.handle(this);
+            }
+
+            void marshal(java.io.DataOutputStream out) throws java.io.IOException
+            {
+                out.writeByte(0x51);
+                out.writeByte(3);
+
+                // Protocol name
+
+                out.writeByte(20);
+                out.writeByte(-74);
+                out.writeByte(5);
+                out.writeByte(-22);
+                out.writeByte(96);
+
+                // Message name
+
+                out.writeByte(18);
+                out.writeByte(22);
+                out.writeByte(-3);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            void _marshal(java.nio.ByteBuffer out) throws java.io.IOException
+            {
+                out.put((byte)0x51);
+                out.put((byte)3);
+
+                // Protocol name
+
+                out.put((byte)20);
+                out.put((byte)-74);
+                out.put((byte)5);
+                out.put((byte)-22);
+                out.put((byte)96);
+
+                // Message name
+
+                out.put((byte)18);
+                out.put((byte)22);
+                out.put((byte)-3);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            public boolean equals(Object _o)
+            {
+                if (_o instanceof foveation) {
+                    foveation o = (foveation) _o;
+
+                    return eyes == o.eyes && 
+                        fovea_percent == o.fovea_percent && 
+                        periphery_scale == o.periphery_scale;
+                }
+
+                return false;
+            }
+
+            public int hashCode()
+            {
+                return eyes + 
+                        fovea_percent + 
+                        periphery_scale;
+            }
+
+            public java.lang.String toString()
+            {
+                StringBuilder buf = new StringBuilder("Request foveation {\n");
+
+                buf.append("    int32 eyes = ");
+                buf.append(eyes);
+                buf.append(";\n");
+
+                buf.append("    int32 fovea_percent = ");
+                buf.append(fovea_percent);
+                buf.append(";\n");
+
+                buf.append("    int32 periphery_scale = ");
+                buf.append(periphery_scale);
+                buf.append(";\n");
+
+                buf.append("}\n");
+                return buf.toString();
+            }
+        }
+
+        public static class stereo extends Request {
+            static final long serialVersionUID = -1432722837L;
+            public int layout;
+
+            public stereo()
+            {
+                layout = 0;
+            }
+
+            public void deliverTo(Receiver r)
+            {
+                r.handle(this);
+            }
+
+            void marshal(java.io.DataOutputStream out) throws java.io.IOException
+            {
+                out.writeByte(0x51);
+                out.writeByte(3);
+
+                // Protocol name
+
+                out.writeByte(20);
+                out.writeByte(-74);
+                out.writeByte(5);
+                out.writeByte(-22);
+                out.writeByte(96);
+
+                // Message name
+
+                out.writeByte(18);
+                out.writeByte(47);
+                out.writeByte(22);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            void _marshal(java.nio.ByteBuffer out) throws java.io.IOException
+            {
+                out.put((byte)0x51);
+                out.put((byte)3);
+
+                // Protocol name
+
+                out.put((byte)20);
+                out.put((byte)-74);
+                out.put((byte)5);
+                out.put((byte)-22);
+                out.put((byte)96);
+
+                // Message name
+
+                out.put((byte)18);
+                out.put((byte)47);
+                out.put((byte)22);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            public boolean equals(Object _o)
+            {
+                if (_o instanceof stereo) {
+                    stereo o = (stereo) _o;
+
+                    return layout == o.layout;
+                }
+
+                return false;
+            }
+
+            public int hashCode()
+            {
+                return layout;
+            }
+
+            public java.lang.String toString()
+            {
+                StringBuilder buf = new StringBuilder("Request stereo {\n");
+
+                buf.append("    int32 layout = ");
+                buf.append(layout);
+                buf.append(";\n");
+
+                buf.append("}\n");
+                return buf.toString();
+            }
+        }
+
+        public static class pose extends Request {
+            static final long serialVersionUID = -1805892646L;
+            public long timestamp_ns;
+            public int yaw;
+            public int pitch;
+            public int fov_x;
+            public int fov_y;
+            public int view_w;
+            public int view_h;
+
+            public pose()
+            {
+                timestamp_ns = 0;
+                yaw = 0;
+                pitch = 0;
+                fov_x = 0;
+                fov_y = 0;
+                view_w = 0;
+                view_h = 0;
+            }
+
+            public void deliverTo(Receiver r)
+            {
+                r.handle(this);
+            }
+
+            void marshal(java.io.DataOutputStream out) throws java.io.IOException
+            {
+                out.writeByte(0x51);
+                out.writeByte(3);
+
+                // Protocol name
+
+                out.writeByte(20);
+                out.writeByte(-74);
+                out.writeByte(5);
+                out.writeByte(-22);
+                out.writeByte(96);
+
+                // Message name
+
+                out.writeByte(18);
+                out.writeByte(68);
+                out.writeByte(-115);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            void _marshal(java.nio.ByteBuffer out) throws java.io.IOException
+            {
+                out.put((byte)0x51);
+                out.put((byte)3);
+
+                // Protocol name
+
+                out.put((byte)20);
+                out.put((byte)-74);
+                out.put((byte)5);
+                out.put((byte)-22);
+                out.put((byte)96);
+
+                // Message name
+
+                out.put((byte)18);
+                out.put((byte)68);
+                out.put((byte)-115);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            public boolean equals(Object _o)
+            {
+                if (_o instanceof pose) {
+                    pose o = (pose) _o;
+
+                    return timestamp_ns == o.timestamp_ns && 
+                        yaw == o.yaw && 
+                        pitch == o.pitch && 
+                        fov_x == o.fov_x && 
+                        fov_y == o.fov_y && 
+                        view_w == o.view_w && 
+                        view_h == o.view_h;
+                }
+
+                return false;
+            }
+
+            public int hashCode()
+            {
+                return (new Long(timestamp_ns).hashCode()) + 
+                        yaw + 
+                        pitch + 
+                        fov_x + 
+                        fov_y + 
+                        view_w + 
+                        view_h;
+            }
+
+            public java.lang.String toString()
+            {
+                StringBuilder buf = new StringBuilder("Request pose {\n");
+
+                buf.append("    int64 timestamp_ns = ");
+                buf.append(timestamp_ns);
+                buf.append(";\n");
+
+                buf.append("    int32 yaw = ");
+                buf.append(yaw);
+                buf.append(";\n");
+
+                buf.append("    int32 pitch = ");
+                buf.append(pitch);
+                buf.append(";\n");
+
+                buf.append("    int32 fov_x = ");
+                buf.append(fov_x);
+                buf.append(";\n");
+
+                buf.append("    int32 fov_y = ");
+                buf.append(fov_y);
+                buf.append(";\n");
+
+                buf.append("    int32 view_w = ");
+                buf.append(view_w);
+                buf.append(";\n");
+
+                buf.append("    int32 view_h = ");
+                buf.append(view_h);
+                buf.append(";\n");
+
+                buf.append("}\n");
+                return buf.toString();
+            }
+        }
+
+    }
+
+    //
+    // Reply types
+    //
+    public abstract static class Reply extends broadcast {
+
+        public static broadcast.Reply unmarshal(java.io.InputStream is) throws java.io.IOException
+        {
+            java.io.DataInputStream in = new java.io.DataInputStream(is);
+
+            byte[] hdr = new byte[3];
+            if (in.read(hdr) != hdr.length)
+                throw new java.io.IOException("invalid SDD message format");
+
+            if (!(new java.lang.String(hdr)).equals("SDD"))
+                throw new java.io.IOException("invalid SDD message format");
+
+            if (in.readByte() != 2)
+                throw new java.io.IOException("invalid SDD version number");
+
+            if (readLength(in, 0x50) != 3)
+                throw new java.io.IOException("invalid start of message for the 'broadcast' protocol");
+
+            if (unmarshal_int32(in) != -1241126304)
+                throw new java.io.IOException("unknown protocol");
+
+            switch (unmarshal_int16(in)) {
+             case -11031:
+                return unmarshal_Error(in);
+
+             case -32638:
+                return unmarshal_connected(in);
+
+             case -32373:
+                return unmarshal_frame(in);
+
+             case 10058:
+                return unmarshal_tick(in);
+
+             case 18418:
+                return unmarshal_cursor_shape(in);
+
+             case 4727:
+                return unmarshal_cursor_pos(in);
+
+             case -19972:
+                return unmarshal_chunk(in);
+
+             case -27679:
+                return unmarshal_pipeline(in);
+
+             case 18756:
+                return unmarshal_viewport(in);
+
+             default:
+                throw new java.io.IOException("invalid message for 'broadcast' protocol");
+            }
+        }
+
+        static void marshal(java.io.DataOutputStream out, Error v) throws java.io.IOException
+        {
+            out.writeByte(81);
+            out.writeByte(4);
+
+            out.writeByte(18);
+            out.writeByte(103);
+            out.writeByte(-108);
+            marshal(out, v.code);
+
+            out.writeByte(18);
+            out.writeByte(49);
+            out.writeByte(2);
+            marshal(out, v.message);
+        }
+
+        static void marshal(java.io.DataOutputStream out, connected v) throws java.io.IOException
+        {
+            out.writeByte(81);
+            out.writeByte(2);
+
+            out.writeByte(18);
+            out.writeByte(-16);
+            out.writeByte(-49);
+            marshal(out, v.server_version);
+        }
+
+        static void marshal(java.io.DataOutputStream out, frame v) throws java.io.IOException
+        {
+            out.writeByte(81);
+            out.writeByte(10);
+
+            out.writeByte(18);
+            out.writeByte(-104);
+            out.writeByte(-68);
+            marshal(out, v.timestamp_ns);
+
+            out.writeByte(18);
+            out.writeByte(104);
+            out.writeByte(-42);
+            marshal(out, v.flags);
+
+            out.writeByte(18);
+            out.writeByte(1);
+            out.writeByte(-122);
+            marshal(out, v.w);
+
+            out.writeByte(18);
+            out.writeByte(-61);
+            out.writeByte(-112);
+            marshal(out, v.h);
+
+            out.writeByte(18);
+            out.writeByte(127);
+            out.writeByte(56);
+            marshal(out, v.data);
+        }
+
+        static void marshal(java.io.DataOutputStream out, tick v) throws java.io.IOException
+        {
+            out.writeByte(81);
+            out.writeByte(2);
+
+            out.writeByte(18);
+            out.writeByte(-104);
+            out.writeByte(-68);
+            marshal(out, v.timestamp_ns);
+        }
+
+        static void marshal(java.io.DataOutputStream out, cursor_shape v) throws java.io.IOException
+        {
+            out.writeByte(81);
+            out.writeByte(12);
+
+            out.writeByte(18);
+            out.writeByte(107);
+            out.writeByte(36);
+            marshal(out, v.serial);
+
+            out.writeByte(18);
+            out.writeByte(67);
+            out.writeByte(-126);
+            marshal(out, v.hot_x);
+
+            out.writeByte(18);
+            out.writeByte(-124);
+            out.writeByte(-76);
+            marshal(out, v.hot_y);
+
+            out.writeByte(18);
+            out.writeByte(1);
+            out.writeByte(-122);
+            marshal(out, v.w);
+
+            out.writeByte(18);
+            out.writeByte(-61);
+            out.writeByte(-112);
+            marshal(out, v.h);
+
+            out.writeByte(18);
+            out.writeByte(127);
+            out.writeByte(56);
+            marshal(out, v.data);
+        }
+
+        static void marshal(java.io.DataOutputStream out, cursor_pos v) throws java.io.IOException
+        {
+            out.writeByte(81);
+            out.writeByte(6);
+
+            out.writeByte(18);
+            out.writeByte(107);
+            out.writeByte(36);
+            marshal(out, v.serial);
+
+            out.writeByte(18);
+            out.writeByte(-28);
+            out.writeByte(97);
+            marshal(out, v.x);
+
+            out.writeByte(18);
+            out.writeByte(-112);
+            out.writeByte(118);
+            marshal(out, v.y);
+        }
+
+        static void marshal(java.io.DataOutputStream out, chunk v) throws java.io.IOException
+        {
+            out.writeByte(81);
+            out.writeByte(6);
+
+            out.writeByte(18);
+            out.writeByte(-63);
+            out.writeByte(87);
+            marshal(out, v.offset);
+
+            out.writeByte(18);
+            out.writeByte(75);
+            out.writeByte(68);
+            marshal(out, v.total);
+
+            out.writeByte(18);
+            out.writeByte(127);
+            out.writeByte(56);
+            marshal(out, v.data);
+        }
+
+        static void marshal(java.io.DataOutputStream out, pipeline v) throws java.io.IOException
+        {
+            out.writeByte(81);
+            out.writeByte(6);
+
+            out.writeByte(18);
+            out.writeByte(-53);
+            out.writeByte(100);
+            marshal(out, v.codec);
+
+            out.writeByte(18);
+            out.writeByte(100);
+            out.writeByte(71);
+            marshal(out, v.lossless_codec);
+
+            out.writeByte(18);
+            out.writeByte(-112);
+            out.writeByte(115);
+            marshal(out, v.max_fps);
+        }
+
+        static void marshal(java.io.DataOutputStream out, viewport v) throws java.io.IOException
+        {
+            out.writeByte(81);
+            out.writeByte(8);
+
+            out.writeByte(18);
+            out.writeByte(-104);
+            out.writeByte(-68);
+            marshal(out, v.timestamp_ns);
+
+            out.writeByte(18);
+            out.writeByte(12);
+            out.writeByte(96);
+            marshal(out, v.pose_timestamp_ns);
+
+            out.writeByte(18);
+            out.writeByte(-28);
+            out.writeByte(97);
+            marshal(out, v.x);
+
+            out.writeByte(18);
+            out.writeByte(-112);
+            out.writeByte(118);
+            marshal(out, v.y);
+        }
+
+        static Error unmarshal_Error(java.io.DataInputStream in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
+
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
+
+            java.util.BitSet flg = new java.util.BitSet(2);
+            Error d = new Error();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case 26516: //int32 code
+                {
+                    flg.set(0);
+                    d.code = unmarshal_int32(in);
+                }
+                break;
+
+             case 12546: //string message
+                {
+                    flg.set(1);
+                    d.message = unmarshal_string(in);
+                }
+                break;
+
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 2)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
+        }
+
+        static connected unmarshal_connected(java.io.DataInputStream in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
+
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
+
+            java.util.BitSet flg = new java.util.BitSet(1);
+            connected d = new connected();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case -3889: //int32 server_version
+                {
+                    flg.set(0);
+                    d.server_version = unmarshal_int32(in);
+                }
+                break;
+
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 1)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
+        }
+
+        static frame unmarshal_frame(java.io.DataInputStream in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
+
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
+
+            java.util.BitSet flg = new java.util.BitSet(5);
+            frame d = new frame();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case -26436: //int64 timestamp_ns
+                {
+                    flg.set(0);
+                    d.timestamp_ns = unmarshal_int64(in);
+                }
+                break;
+
+             case 26838: //int32 flags
+                {
+                    flg.set(1);
+                    d.flags = unmarshal_int32(in);
+                }
+                break;
+
+             case 390: //int32 w
+                {
+                    flg.set(2);
+                    d.w = unmarshal_int32(in);
+                }
+                break;
+
+             case -15472: //int32 h
+                {
+                    flg.set(3);
+                    d.h = unmarshal_int32(in);
+                }
+                break;
+
+             case 32568: //binary data
+                {
+                    flg.set(4);
+                    d.data = unmarshal_binary(in);
+                }
+                break;
+
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 5)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
+        }
+
+        static tick unmarshal_tick(java.io.DataInputStream in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
+
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
+
+            java.util.BitSet flg = new java.util.BitSet(1);
+            tick d = new tick();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case -26436: //int64 timestamp_ns
+                {
+                    flg.set(0);
+                    d.timestamp_ns = unmarshal_int64(in);
+                }
+                break;
+
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 1)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
+        }
+
+        static cursor_shape unmarshal_cursor_shape(java.io.DataInputStream in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
+
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
+
+            java.util.BitSet flg = new java.util.BitSet(6);
+            cursor_shape d = new cursor_shape();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case 27428: //int64 serial
+                {
+                    flg.set(0);
+                    d.serial = unmarshal_int64(in);
+                }
+                break;
+
+             case 17282: //int32 hot_x
+                {
+                    flg.set(1);
+                    d.hot_x = unmarshal_int32(in);
+                }
+                break;
+
+             case -31564: //int32 hot_y
+                {
+                    flg.set(2);
+                    d.hot_y = unmarshal_int32(in);
+                }
+                break;
+
+             case 390: //int32 w
+                {
+                    flg.set(3);
+                    d.w = unmarshal_int32(in);
+                }
+                break;
+
+             case -15472: //int32 h
+                {
+                    flg.set(4);
+                    d.h = unmarshal_int32(in);
+                }
+                break;
+
+             case 32568: //binary data
+                {
+                    flg.set(5);
+                    d.data = unmarshal_binary(in);
+                }
+                break;
+
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 6)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
+        }
+
+        static cursor_pos unmarshal_cursor_pos(java.io.DataInputStream in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
+
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
+
+            java.util.BitSet flg = new java.util.BitSet(3);
+            cursor_pos d = new cursor_pos();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case 27428: //int64 serial
+                {
+                    flg.set(0);
+                    d.serial = unmarshal_int64(in);
+                }
+                break;
+
+             case -7071: //int32 x
+                {
+                    flg.set(1);
+                    d.x = unmarshal_int32(in);
+                }
+                break;
+
+             case -28554: //int32 y
+                {
+                    flg.set(2);
+                    d.y = unmarshal_int32(in);
+                }
+                break;
+
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 3)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
+        }
+
+        static chunk unmarshal_chunk(java.io.DataInputStream in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
+
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
+
+            java.util.BitSet flg = new java.util.BitSet(3);
+            chunk d = new chunk();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case -16041: //int32 offset
+                {
+                    flg.set(0);
+                    d.offset = unmarshal_int32(in);
+                }
+                break;
+
+             case 19268: //int32 total
+                {
+                    flg.set(1);
+                    d.total = unmarshal_int32(in);
+                }
+                break;
+
+             case 32568: //binary data
+                {
+                    flg.set(2);
+                    d.data = unmarshal_binary(in);
+                }
+                break;
+
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 3)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
+        }
+
+        static pipeline unmarshal_pipeline(java.io.DataInputStream in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
+
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
+
+            java.util.BitSet flg = new java.util.BitSet(3);
+            pipeline d = new pipeline();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case -13468: //int32 codec
+                {
+                    flg.set(0);
+                    d.codec = unmarshal_int32(in);
+                }
+                break;
+
+             case 25671: //int32 lossless_codec
+                {
+                    flg.set(1);
+                    d.lossless_codec = unmarshal_int32(in);
+                }
+                break;
+
+             case -28557: //int32 max_fps
+                {
+                    flg.set(2);
+                    d.max_fps = unmarshal_int32(in);
+                }
+                break;
+
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 3)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
+        }
+
+        static viewport unmarshal_viewport(java.io.DataInputStream in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
+
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
+
+            java.util.BitSet flg = new java.util.BitSet(4);
+            viewport d = new viewport();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case -26436: //int64 timestamp_ns
+                {
+                    flg.set(0);
+                    d.timestamp_ns = unmarshal_int64(in);
+                }
+                break;
+
+             case 3168: //int64 pose_timestamp_ns
+                {
+                    flg.set(1);
+                    d.pose_timestamp_ns = unmarshal_int64(in);
+                }
+                break;
+
+             case -7071: //int32 x
+                {
+                    flg.set(2);
+                    d.x = unmarshal_int32(in);
+                }
+                break;
+
+             case -28554: //int32 y
+                {
+                    flg.set(3);
+                    d.y = unmarshal_int32(in);
+                }
+                break;
+
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 4)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
+        }
+
+        public static broadcast.Reply unmarshal(java.nio.ByteBuffer in) throws java.io.IOException
+        {
+            byte[] hdr = new byte[3];
+
+            in.get(hdr);
+
+            if (!(new java.lang.String(hdr)).equals("SDD"))
+                throw new java.io.IOException("invalid SDD message format");
+
+            if (in.get() != 2)
+                throw new java.io.IOException("invalid SDD version number");
+
+            if (readLength(in, 0x50) != 3)
+                throw new java.io.IOException("invalid start of message for the 'broadcast' protocol");
+
+            if (unmarshal_int32(in) != -1241126304)
+                throw new java.io.IOException("unknown protocol");
+
+            switch (unmarshal_int16(in)) {
+             case -11031:
+                return unmarshal_Error(in);
+
+             case -32638:
+                return unmarshal_connected(in);
+
+             case -32373:
+                return unmarshal_frame(in);
+
+             case 10058:
+                return unmarshal_tick(in);
+
+             case 18418:
+                return unmarshal_cursor_shape(in);
+
+             case 4727:
+                return unmarshal_cursor_pos(in);
+
+             case -19972:
+                return unmarshal_chunk(in);
+
+             case -27679:
+                return unmarshal_pipeline(in);
+
+             case 18756:
+                return unmarshal_viewport(in);
+
+             default:
+                throw new java.io.IOException("invalid message for 'broadcast' protocol");
+            }
+        }
+
+        static void marshal(java.nio.ByteBuffer out, Error v) throws java.io.IOException
+        {
+            out.put((byte)81);
+            out.put((byte)4);
+
+            out.put((byte)18);
+            out.put((byte)103);
+            out.put((byte)-108);
+            marshal(out, v.code);
+
+            out.put((byte)18);
+            out.put((byte)49);
+            out.put((byte)2);
+            marshal(out, v.message);
+        }
+
+        static void marshal(java.nio.ByteBuffer out, connected v) throws java.io.IOException
+        {
+            out.put((byte)81);
+            out.put((byte)2);
+
+            out.put((byte)18);
+            out.put((byte)-16);
+            out.put((byte)-49);
+            marshal(out, v.server_version);
+        }
+
+        static void marshal(java.nio.ByteBuffer out, frame v) throws java.io.IOException
+        {
+            out.put((byte)81);
+            out.put((byte)10);
+
+            out.put((byte)18);
+            out.put((byte)-104);
+            out.put((byte)-68);
+            marshal(out, v.timestamp_ns);
+
+            out.put((byte)18);
+            out.put((byte)104);
+            out.put((byte)-42);
+            marshal(out, v.flags);
+
+            out.put((byte)18);
+            out.put((byte)1);
+            out.put((byte)-122);
+            marshal(out, v.w);
+
+            out.put((byte)18);
+            out.put((byte)-61);
+            out.put((byte)-112);
+            marshal(out, v.h);
+
+            out.put((byte)18);
+            out.put((byte)127);
+            out.put((byte)56);
+            marshal(out, v.data);
+        }
+
+        static void marshal(java.nio.ByteBuffer out, tick v) throws java.io.IOException
+        {
+            out.put((byte)81);
+            out.put((byte)2);
+
+            out.put((byte)18);
+            out.put((byte)-104);
+            out.put((byte)-68);
+            marshal(out, v.timestamp_ns);
+        }
+
+        static void marshal(java.nio.ByteBuffer out, cursor_shape v) throws java.io.IOException
+        {
+            out.put((byte)81);
+            out.put((byte)12);
+
+            out.put((byte)18);
+            out.put((byte)107);
+            out.put((byte)36);
+            marshal(out, v.serial);
+
+            out.put((byte)18);
+            out.put((byte)67);
+            out.put((byte)-126);
+            marshal(out, v.hot_x);
+
+            out.put((byte)18);
+            out.put((byte)-124);
+            out.put((byte)-76);
+            marshal(out, v.hot_y);
+
+            out.put((byte)18);
+            out.put((byte)1);
+            out.put((byte)-122);
+            marshal(out, v.w);
+
+            out.put((byte)18);
+            out.put((byte)-61);
+            out.put((byte)-112);
+            marshal(out, v.h);
+
+            out.put((byte)18);
+            out.put((byte)127);
+            out.put((byte)56);
+            marshal(out, v.data);
+        }
+
+        static void marshal(java.nio.ByteBuffer out, cursor_pos v) throws java.io.IOException
+        {
+            out.put((byte)81);
+            out.put((byte)6);
+
+            out.put((byte)18);
+            out.put((byte)107);
+            out.put((byte)36);
+            marshal(out, v.serial);
+
+            out.put((byte)18);
+            out.put((byte)-28);
+            out.put((byte)97);
+            marshal(out, v.x);
+
+            out.put((byte)18);
+            out.put((byte)-112);
+            out.put((byte)118);
+            marshal(out, v.y);
+        }
+
+        static void marshal(java.nio.ByteBuffer out, chunk v) throws java.io.IOException
+        {
+            out.put((byte)81);
+            out.put((byte)6);
+
+            out.put((byte)18);
+            out.put((byte)-63);
+            out.put((byte)87);
+            marshal(out, v.offset);
+
+            out.put((byte)18);
+            out.put((byte)75);
+            out.put((byte)68);
+            marshal(out, v.total);
+
+            out.put((byte)18);
+            out.put((byte)127);
+            out.put((byte)56);
+            marshal(out, v.data);
+        }
+
+        static void marshal(java.nio.ByteBuffer out, pipeline v) throws java.io.IOException
+        {
+            out.put((byte)81);
+            out.put((byte)6);
+
+            out.put((byte)18);
+            out.put((byte)-53);
+            out.put((byte)100);
+            marshal(out, v.codec);
+
+            out.put((byte)18);
+            out.put((byte)100);
+            out.put((byte)71);
+            marshal(out, v.lossless_codec);
+
+            out.put((byte)18);
+            out.put((byte)-112);
+            out.put((byte)115);
+            marshal(out, v.max_fps);
+        }
+
+        static void marshal(java.nio.ByteBuffer out, viewport v) throws java.io.IOException
+        {
+            out.put((byte)81);
+            out.put((byte)8);
+
+            out.put((byte)18);
+            out.put((byte)-104);
+            out.put((byte)-68);
+            marshal(out, v.timestamp_ns);
+
+            out.put((byte)18);
+            out.put((byte)12);
+            out.put((byte)96);
+            marshal(out, v.pose_timestamp_ns);
+
+            out.put((byte)18);
+            out.put((byte)-28);
+            out.put((byte)97);
+            marshal(out, v.x);
+
+            out.put((byte)18);
+            out.put((byte)-112);
+            out.put((byte)118);
+            marshal(out, v.y);
+        }
+
+        static Error unmarshal_Error(java.nio.ByteBuffer in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
+
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
+
+            java.util.BitSet flg = new java.util.BitSet(2);
+            Error d = new Error();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case 26516: //int32 code
+                {
+                    flg.set(0);
+                    d.code = unmarshal_int32(in);
+                }
+                break;
+
+             case 12546: //string message
+                {
+                    flg.set(1);
+                    d.message = unmarshal_string(in);
+                }
+                break;
+
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 2)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
+        }
+
+        static connected unmarshal_connected(java.nio.ByteBuffer in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
+
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
+
+            java.util.BitSet flg = new java.util.BitSet(1);
+            connected d = new connected();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case -3889: //int32 server_version
+                {
+                    flg.set(0);
+                    d.server_version = unmarshal_int32(in);
+                }
+                break;
+
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 1)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
+        }
+
+        static frame unmarshal_frame(java.nio.ByteBuffer in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
+
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
+
+            java.util.BitSet flg = new java.util.BitSet(5);
+            frame d = new frame();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case -26436: //int64 timestamp_ns
+                {
+                    flg.set(0);
+                    d.timestamp_ns = unmarshal_int64(in);
+                }
+                break;
+
+             case 26838: //int32 flags
+                {
+                    flg.set(1);
+                    d.flags = unmarshal_int32(in);
+                }
+                break;
+
+             case 390: //int32 w
+                {
+                    flg.set(2);
+                    d.w = unmarshal_int32(in);
+                }
+                break;
+
+             case -15472: //int32 h
+                {
+                    flg.set(3);
+                    d.h = unmarshal_int32(in);
+                }
+                break;
+
+             case 32568: //binary data
+                {
+                    flg.set(4);
+                    d.data = unmarshal_binary(in);
+                }
+                break;
+
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 5)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
+        }
+
+        static tick unmarshal_tick(java.nio.ByteBuffer in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
+
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
+
+            java.util.BitSet flg = new java.util.BitSet(1);
+            tick d = new tick();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case -26436: //int64 timestamp_ns
+                {
+                    flg.set(0);
+                    d.timestamp_ns = unmarshal_int64(in);
+                }
+                break;
+
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 1)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
+        }
+
+        static cursor_shape unmarshal_cursor_shape(java.nio.ByteBuffer in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
+
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
+
+            java.util.BitSet flg = new java.util.BitSet(6);
+            cursor_shape d = new cursor_shape();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case 27428: //int64 serial
+                {
+                    flg.set(0);
+                    d.serial = unmarshal_int64(in);
+                }
+                break;
+
+             case 17282: //int32 hot_x
+                {
+                    flg.set(1);
+                    d.hot_x = unmarshal_int32(in);
+                }
+                break;
+
+             case -31564: //int32 hot_y
+                {
+                    flg.set(2);
+                    d.hot_y = unmarshal_int32(in);
+                }
+                break;
+
+             case 390: //int32 w
+                {
+                    flg.set(3);
+                    d.w = unmarshal_int32(in);
+                }
+                break;
+
+             case -15472: //int32 h
+                {
+                    flg.set(4);
+                    d.h = unmarshal_int32(in);
+                }
+                break;
+
+             case 32568: //binary data
+                {
+                    flg.set(5);
+                    d.data = unmarshal_binary(in);
+                }
+                break;
+
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 6)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
+        }
+
+        static cursor_pos unmarshal_cursor_pos(java.nio.ByteBuffer in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
+
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
+
+            java.util.BitSet flg = new java.util.BitSet(3);
+            cursor_pos d = new cursor_pos();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case 27428: //int64 serial
+                {
+                    flg.set(0);
+                    d.serial = unmarshal_int64(in);
+                }
+                break;
+
+             case -7071: //int32 x
+                {
+                    flg.set(1);
+                    d.x = unmarshal_int32(in);
+                }
+                break;
+
+             case -28554: //int32 y
+                {
+                    flg.set(2);
+                    d.y = unmarshal_int32(in);
+                }
+                break;
+
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 3)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
+        }
+
+        static chunk unmarshal_chunk(java.nio.ByteBuffer in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
+
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
+
+            java.util.BitSet flg = new java.util.BitSet(3);
+            chunk d = new chunk();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case -16041: //int32 offset
+                {
+                    flg.set(0);
+                    d.offset = unmarshal_int32(in);
+                }
+                break;
+
+             case 19268: //int32 total
+                {
+                    flg.set(1);
+                    d.total = unmarshal_int32(in);
+                }
+                break;
+
+             case 32568: //binary data
+                {
+                    flg.set(2);
+                    d.data = unmarshal_binary(in);
+                }
+                break;
+
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 3)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
+        }
+
+        static pipeline unmarshal_pipeline(java.nio.ByteBuffer in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
+
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
+
+            java.util.BitSet flg = new java.util.BitSet(3);
+            pipeline d = new pipeline();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case -13468: //int32 codec
+                {
+                    flg.set(0);
+                    d.codec = unmarshal_int32(in);
+                }
+                break;
+
+             case 25671: //int32 lossless_codec
+                {
+                    flg.set(1);
+                    d.lossless_codec = unmarshal_int32(in);
+                }
+                break;
+
+             case -28557: //int32 max_fps
+                {
+                    flg.set(2);
+                    d.max_fps = unmarshal_int32(in);
+                }
+                break;
+
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 3)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
+        }
+
+        static viewport unmarshal_viewport(java.nio.ByteBuffer in) throws java.io.IOException
+        {
+            final int flds = readLength(in, 0x50);
+
+            if (flds < 0)
+                throw new java.io.IOException("invalid array size");
+
+            java.util.BitSet flg = new java.util.BitSet(4);
+            viewport d = new viewport();
+
+            for (int ii = 0; ii < flds; ii += 2) {
+                switch (unmarshal_int16(in)) {
+             case -26436: //int64 timestamp_ns
+                {
+                    flg.set(0);
+                    d.timestamp_ns = unmarshal_int64(in);
+                }
+                break;
+
+             case 3168: //int64 pose_timestamp_ns
+                {
+                    flg.set(1);
+                    d.pose_timestamp_ns = unmarshal_int64(in);
+                }
+                break;
+
+             case -7071: //int32 x
+                {
+                    flg.set(2);
+                    d.x = unmarshal_int32(in);
+                }
+                break;
+
+             case -28554: //int32 y
+                {
+                    flg.set(3);
+                    d.y = unmarshal_int32(in);
+                }
+                break;
+
+                 default:
+                    throw new java.io.IOException("unknown field in message");
+                }
+            }
+
+            if (flg.cardinality() != 4)
+                throw new java.io.IOException("missing required field(s)");
+
+            return d;
+        }
+
+        // Interface for receiving all messages.
+
+        public interface Receiver {
+            void handle(Error m);
+            void handle(connected m);
+            void handle(frame m);
+            void handle(tick m);
+            void handle(cursor_shape m);
+            void handle(cursor_pos m);
+            void handle(chunk m);
+            void handle(pipeline m);
+            void handle(viewport m);
+        }
+
+        public abstract void deliverTo(Receiver r);
+
+        public static class Error extends Reply {
+            static final long serialVersionUID = 74909004L;
+            public int code;
+            public java.lang.String message;
+
+            public Error()
+            {
+                code = 0;
+                message = "";
+            }
+
+            public void deliverTo(Receiver r)
+            {
+                r.handle(this);
+            }
+
+            void marshal(java.io.DataOutputStream out) throws java.io.IOException
+            {
+                out.writeByte(0x51);
+                out.writeByte(3);
+
+                // Protocol name
+
+                out.writeByte(20);
+                out.writeByte(-74);
+                out.writeByte(5);
+                out.writeByte(-22);
+                out.writeByte(96);
+
+                // Message name
+
+                out.writeByte(18);
+                out.writeByte(-44);
+                out.writeByte(-23);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            void _marshal(java.nio.ByteBuffer out) throws java.io.IOException
+            {
+                out.put((byte)0x51);
+                out.put((byte)3);
+
+                // Protocol name
+
+                out.put((byte)20);
+                out.put((byte)-74);
+                out.put((byte)5);
+                out.put((byte)-22);
+                out.put((byte)96);
+
+                // Message name
+
+                out.put((byte)18);
+                out.put((byte)-44);
+                out.put((byte)-23);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            public boolean equals(Object _o)
+            {
+                if (_o instanceof Error) {
+                    Error o = (Error) _o;
+
+                    return code == o.code && 
+                        broadcast.equals(message, o.message);
+                }
+
+                return false;
+            }
+
+            public int hashCode()
+            {
+                return code + 
+                        message.hashCode();
+            }
+
+            public java.lang.String toString()
+            {
+                StringBuilder buf = new StringBuilder("Reply Error {\n");
+
+                buf.append("    int32 code = ");
+                buf.append(code);
+                buf.append(";\n");
+
+                buf.append("    string message = ");
+                if (message != null)
+                    buf.append('"');
+                buf.append(message);
+                if (message != null)
+                    buf.append('"');
+                buf.append(";\n");
+
+                buf.append("}\n");
+                return buf.toString();
+            }
+        }
+
+        public static class connected extends Reply {
+            static final long serialVersionUID = -16502658L;
+            public int server_version;
+
+            public connected()
+            {
+                server_version = 0;
+            }
+
+            public void deliverTo(Receiver r)
+            {
+                r.handle(this);
+            }
+
+            void marshal(java.io.DataOutputStream out) throws java.io.IOException
+            {
+                out.writeByte(0x51);
+                out.writeByte(3);
+
+                // Protocol name
+
+                out.writeByte(20);
+                out.writeByte(-74);
+                out.writeByte(5);
+                out.writeByte(-22);
+                out.writeByte(96);
+
+                // Message name
+
+                out.writeByte(18);
+                out.writeByte(-128);
+                out.writeByte(-126);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            void _marshal(java.nio.ByteBuffer out) throws java.io.IOException
+            {
+                out.put((byte)0x51);
+                out.put((byte)3);
+
+                // Protocol name
+
+                out.put((byte)20);
+                out.put((byte)-74);
+                out.put((byte)5);
+                out.put((byte)-22);
+                out.put((byte)96);
+
+                // Message name
+
+                out.put((byte)18);
+                out.put((byte)-128);
+                out.put((byte)-126);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            public boolean equals(Object _o)
+            {
+                if (_o instanceof connected) {
+                    connected o = (connected) _o;
+
+                    return server_version == o.server_version;
+                }
+
+                return false;
+            }
+
+            public int hashCode()
+            {
+                return server_version;
+            }
+
+            public java.lang.String toString()
+            {
+                StringBuilder buf = new StringBuilder("Reply connected {\n");
+
+                buf.append("    int32 server_version = ");
+                buf.append(server_version);
+                buf.append(";\n");
+
+                buf.append("}\n");
+                return buf.toString();
+            }
+        }
+
+        public static class frame extends Reply {
+            static final long serialVersionUID = -2055670749L;
+            public long timestamp_ns;
+            public int flags;
+            public int w;
+            public int h;
+            public byte[] data;
+
+            public frame()
+            {
+                timestamp_ns = 0;
+                flags = 0;
+                w = 0;
+                h = 0;
+                data = new byte[0];
+            }
+
+            public void deliverTo(Receiver r)
+            {
+                r.handle(this);
+            }
+
+            void marshal(java.io.DataOutputStream out) throws java.io.IOException
+            {
+                out.writeByte(0x51);
+                out.writeByte(3);
+
+                // Protocol name
+
+                out.writeByte(20);
+                out.writeByte(-74);
+                out.writeByte(5);
+                out.writeByte(-22);
+                out.writeByte(96);
+
+                // Message name
+
+                out.writeByte(18);
+                out.writeByte(-127);
+                out.writeByte(-117);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            void _marshal(java.nio.ByteBuffer out) throws java.io.IOException
+            {
+                out.put((byte)0x51);
+                out.put((byte)3);
+
+                // Protocol name
+
+                out.put((byte)20);
+                out.put((byte)-74);
+                out.put((byte)5);
+                out.put((byte)-22);
+                out.put((byte)96);
+
+                // Message name
+
+                out.put((byte)18);
+                out.put((byte)-127);
+                out.put((byte)-117);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            public boolean equals(Object _o)
+            {
+                if (_o instanceof frame) {
+                    frame o = (frame) _o;
+
+                    return timestamp_ns == o.timestamp_ns && 
+                        flags == o.flags && 
+                        w == o.w && 
+                        h == o.h && 
+                        broadcast.equals(data, o.data);
+                }
+
+                return false;
+            }
+
+            public int hashCode()
+            {
+                return (new Long(timestamp_ns).hashCode()) + 
+                        flags + 
+                        w + 
+                        h + 
+                        java.util.Arrays.hashCode(data);
+            }
+
+            public java.lang.String toString()
+            {
+                StringBuilder buf = new StringBuilder("Reply frame {\n");
+
+                buf.append("    int64 timestamp_ns = ");
+                buf.append(timestamp_ns);
+                buf.append(";\n");
+
+                buf.append("    int32 flags = ");
+                buf.append(flags);
+                buf.append(";\n");
+
+                buf.append("    int32 w = ");
+                buf.append(w);
+                buf.append(";\n");
+
+                buf.append("    int32 h = ");
+                buf.append(h);
+                buf.append(";\n");
+
+                buf.append("    binary data = ");
+                if (data != null) {
+                    buf.append("binary[");
+                    buf.append(data.length);
+                    buf.append("];\n");
+                } else
+                    buf.append("null;\n");
+
+                buf.append("}\n");
+                return buf.toString();
+            }
+        }
+
+        public static class tick extends Reply {
+            static final long serialVersionUID = 1780677906L;
+            public long timestamp_ns;
+
+            public tick()
+            {
+                timestamp_ns = 0;
+            }
+
+            public void deliverTo(Receiver r)
+            {
+                r.handle(this);
+            }
+
+            void marshal(java.io.DataOutputStream out) throws java.io.IOException
+            {
+                out.writeByte(0x51);
+                out.writeByte(3);
+
+                // Protocol name
+
+                out.writeByte(20);
+                out.writeByte(-74);
+                out.writeByte(5);
+                out.writeByte(-22);
+                out.writeByte(96);
+
+                // Message name
+
+                out.writeByte(18);
+                out.writeByte(39);
+                out.writeByte(74);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            void _marshal(java.nio.ByteBuffer out) throws java.io.IOException
+            {
+                out.put((byte)0x51);
+                out.put((byte)3);
+
+                // Protocol name
+
+                out.put((byte)20);
+                out.put((byte)-74);
+                out.put((byte)5);
+                out.put((byte)-22);
+                out.put((byte)96);
+
+                // Message name
+
+                out.put((byte)18);
+                out.put((byte)39);
+                out.put((byte)74);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            public boolean equals(Object _o)
+            {
+                if (_o instanceof tick) {
+                    tick o = (tick) _o;
+
+                    return timestamp_ns == o.timestamp_ns;
+                }
+
+                return false;
+            }
+
+            public int hashCode()
+            {
+                return (new Long(timestamp_ns).hashCode());
+            }
+
+            public java.lang.String toString()
+            {
+                StringBuilder buf = new StringBuilder("Reply tick {\n");
+
+                buf.append("    int64 timestamp_ns = ");
+                buf.append(timestamp_ns);
+                buf.append(";\n");
+
+                buf.append("}\n");
+                return buf.toString();
+            }
+        }
+
+        public static class cursor_shape extends Reply {
+            static final long serialVersionUID = 1505161577L;
+            public long serial;
+            public int hot_x;
+            public int hot_y;
+            public int w;
+            public int h;
+            public byte[] data;
+
+            public cursor_shape()
+            {
+                serial = 0;
+                hot_x = 0;
+                hot_y = 0;
+                w = 0;
+                h = 0;
+                data = new byte[0];
+            }
+
+            public void deliverTo(Receiver r)
+            {
+                r.handle(this);
+            }
+
+            void marshal(java.io.DataOutputStream out) throws java.io.IOException
+            {
+                out.writeByte(0x51);
+                out.writeByte(3);
+
+                // Protocol name
+
+                out.writeByte(20);
+                out.writeByte(-74);
+                out.writeByte(5);
+                out.writeByte(-22);
+                out.writeByte(96);
+
+                // Message name
+
+                out.writeByte(18);
+                out.writeByte(71);
+                out.writeByte(-14);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            void _marshal(java.nio.ByteBuffer out) throws java.io.IOException
+            {
+                out.put((byte)0x51);
+                out.put((byte)3);
+
+                // Protocol name
+
+                out.put((byte)20);
+                out.put((byte)-74);
+                out.put((byte)5);
+                out.put((byte)-22);
+                out.put((byte)96);
+
+                // Message name
+
+                out.put((byte)18);
+                out.put((byte)71);
+                out.put((byte)-14);
+
+                // Message
+
+                marshal(out, this);
+            }
+
+            public boolean equals(Object _o)
+            {
+                if (_o instanceof cursor_shape) {
+                    cursor_shape o = (cursor_shape) _o;
+
+                    return serial == o.serial && 
+                        hot_x == o.hot_x && 
+                        hot_y == o.hot_y && 
+                        w == o.w && 
+                        h == o.h && 
+                        broadcast.equals(data, o.data);
+                }
+
+                return false;
+            }
+
+            public int hashCode()
+            {
+                return (new Long(serial).hashCode()) + 
+                        hot_x + 
+                        hot_y + 
+                        w + 
+                        h + 
+                        java.util.Arrays.hashCode(data);
+            }
+
+            public java.lang.String toString()
+            {
+                StringBuilder buf = new StringBuilder("Reply cursor_shape {\n");
+
+                buf.append("    int64 serial = ");
+                buf.append(serial);
+                buf.append(";\n");
+
+                buf.append("    int32 hot_x = ");
+                buf.append(hot_x);
+                buf.append(";\n");
+
+                buf.append("    int32 hot_y = ");
+                buf.append(hot_y);
+                buf.append(";\n");
+
+                buf.append("    int32 w = ");
+                buf.append(w);
+                buf.append(";\n");
+
+                buf.append("    int32 h = ");
+                buf.append(h);
+                buf.append(";\n");
+
+                buf.append("    binary data = ");
+                if (data != null) {
+                    buf.append("binary[");
+                    buf.append(data.length);
+                    buf.append("];\n");
+                } else
+                    buf.append("null;\n");
+
+                buf.append("}\n");
+                return buf.toString();
+            }
+        }
 
-            for (int ii = 0; ii < flds; ii += 2) {
-                switch (unmarshal_int16(in)) {
-             case 26516: //int32 code
-                {
-                    flg.set(0);
-                    d.code = unmarshal_int32(in);
-                }
-                break;
+        public static class cursor_pos extends Reply {
+            static final long serialVersionUID = -1861367945L;
+            public long serial;
+            public int x;
+            public int y;
 
-             case 12546: //string message
-                {
-                    flg.set(1);
-                    d.message = unmarshal_string(in);
-                }
-                break;
+            public cursor_pos()
+            {
+                serial = 0;
+                x = 0;
+                y = 0;
+            }
 
-                 default:
-                    throw new java.io.IOException("unknown field in message");
-                }
+            public void deliverTo(Receiver r)
+            {
+                r.handle(this);
             }
 
-            if (flg.cardinality() != 2)
-                throw new java.io.IOException("missing required field(s)");
+            void marshal(java.io.DataOutputStream out) throws java.io.IOException
+            {
+                out.writeByte(0x51);
+                out.writeByte(3);
 
-            return d;
-        }
+                // Protocol name
 
-        static connected unmarshal_connected(java.nio.ByteBuffer in) throws java.io.IOException
-        {
-            final int flds = readLength(in, 0x50);
+                out.writeByte(20);
+                out.writeByte(-74);
+                out.writeByte(5);
+                out.writeByte(-22);
+                out.writeByte(96);
 
-            if (flds < 0)
-                throw new java.io.IOException("invalid array size");
+                // Message name
 
-            java.util.BitSet flg = new java.util.BitSet(1);
-            connected d = new connected();
+                out.writeByte(18);
+                out.writeByte(18);
+                out.writeByte(119);
 
-            for (int ii = 0; ii < flds; ii += 2) {
-                switch (unmarshal_int16(in)) {
-             case -3889: //int32 server_version
-                {
-                    flg.set(0);
-                    d.server_version = unmarshal_int32(in);
-                }
-                break;
+                // Message
 
-                 default:
-                    throw new java.io.IOException("unknown field in message");
-                }
+                marshal(out, this);
             }
 
-            if (flg.cardinality() != 1)
-                throw new java.io.IOException("missing required field(s)");
+            void _marshal(java.nio.ByteBuffer out) throws java.io.IOException
+            {
+                out.put((byte)0x51);
+                out.put((byte)3);
 
-            return d;
-        }
+                // Protocol name
 
-        static frame unmarshal_frame(java.nio.ByteBuffer in) throws java.io.IOException
-        {
-            final int flds = readLength(in, 0x50);
+                out.put((byte)20);
+                out.put((byte)-74);
+                out.put((byte)5);
+                out.put((byte)-22);
+                out.put((byte)96);
 
-            if (flds < 0)
-                throw new java.io.IOException("invalid array size");
+                // Message name
 
-            java.util.BitSet flg = new java.util.BitSet(5);
-            frame d = new frame();
+                out.put((byte)18);
+                out.put((byte)18);
+                out.put((byte)119);
 
-            for (int ii = 0; ii < flds; ii += 2) {
-                switch (unmarshal_int16(in)) {
-             case -26436: //int64 timestamp_ns
-                {
-                    flg.set(0);
-                    d.timestamp_ns = unmarshal_int64(in);
-                }
-                break;
+                // Message
 
-             case 26838: //int32 flags
-                {
-                    flg.set(1);
-                    d.flags = unmarshal_int32(in);
-                }
-                break;
+                marshal(out, this);
+            }
 
-             case 390: //int32 w
-                {
-                    flg.set(2);
-                    d.w = unmarshal_int32(in);
-                }
-                break;
+            public boolean equals(Object _o)
+            {
+                if (_o instanceof cursor_pos) {
+                    cursor_pos o = (cursor_pos) _o;
 
-             case -15472: //int32 h
-                {
-                    flg.set(3);
-                    d.h = unmarshal_int32(in);
+                    return serial == o.serial && 
+                        x == o.x && 
+                        y == o.y;
                 }
-                break;
 
-             case 32568: //binary data
-                {
-                    flg.set(4);
-                    d.data = unmarshal_binary(in);
-                }
-                break;
+                return false;
+            }
 
-                 default:
-                    throw new java.io.IOException("unknown field in message");
-                }
+            public int hashCode()
+            {
+                return (new Long(serial).hashCode()) + 
+                        x + 
+                        y;
             }
 
-            if (flg.cardinality() != 5)
-                throw new java.io.IOException("missing required field(s)");
+            public java.lang.String toString()
+            {
+                StringBuilder buf = new StringBuilder("Reply cursor_pos {\n");
 
-            return d;
-        }
+                buf.append("    int64 serial = ");
+                buf.append(serial);
+                buf.append(";\n");
 
-        // Interface for receiving all messages.
+                buf.append("    int32 x = ");
+                buf.append(x);
+                buf.append(";\n");
 
-        public interface Receiver {
-            void handle(Error m);
-            void handle(connected m);
-            void handle(frame m);
-        }
+                buf.append("    int32 y = ");
+                buf.append(y);
+                buf.append(";\n");
 
-        public abstract void deliverTo(Receiver r);
+                buf.append("}\n");
+                return buf.toString();
+            }
+        }
 
-        public static class Error extends Reply {
-            static final long serialVersionUID = 74909004L;
-            public int code;
-            public java.lang.String message;
+        public static class chunk extends Reply {
+            static final long serialVersionUID = -2129614141L;
+            public int offset;
+            public int total;
+            public byte[] data;
 
-            public Error()
+            public chunk()
             {
-                code = 0;
-                message = "";
+                offset = 0;
+                total = 0;
+                data = new byte[0];
             }
 
             public void deliverTo(Receiver r)
@@ -1269,8 +5255,8 @@ public abstract class broadcast implements java.io.Serializable {
                 // Message name
 
                 out.writeByte(18);
-                out.writeByte(-44);
-                out.writeByte(-23);
+                out.writeByte(-79);
+                out.writeByte(-4);
 
                 // Message
 
@@ -1293,8 +5279,8 @@ public abstract class broadcast implements java.io.Serializable {
                 // Message name
 
                 out.put((byte)18);
-                out.put((byte)-44);
-                out.put((byte)-23);
+                out.put((byte)-79);
+                out.put((byte)-4);
 
                 // Message
 
@@ -1303,11 +5289,12 @@ public abstract class broadcast implements java.io.Serializable {
 
             public boolean equals(Object _o)
             {
-                if (_o instanceof Error) {
-                    Error o = (Error) _o;
+                if (_o instanceof chunk) {
+                    chunk o = (chunk) _o;
 
-                    return code == o.code && 
-                        broadcast.equals(message, o.message);
+                    return offset == o.offset && 
+                        total == o.total && 
+                        broadcast.equals(data, o.data);
                 }
 
                 return false;
@@ -1315,38 +5302,47 @@ public abstract class broadcast implements java.io.Serializable {
 
             public int hashCode()
             {
-                return code + 
-                        message.hashCode();
+                return offset + 
+                        total + 
+                        java.util.Arrays.hashCode(data);
             }
 
             public java.lang.String toString()
             {
-                StringBuilder buf = new StringBuilder("Reply Error {\n");
+                StringBuilder buf = new StringBuilder("Reply chunk {\n");
 
-                buf.append("    int32 code = ");
-                buf.append(code);
+                buf.append("    int32 offset = ");
+                buf.append(offset);
                 buf.append(";\n");
 
-                buf.append("    string message = ");
-                if (message != null)
-                    buf.append('"');
-                buf.append(message);
-                if (message != null)
-                    buf.append('"');
+                buf.append("    int32 total = ");
+                buf.append(total);
                 buf.append(";\n");
 
+                buf.append("    binary data = ");
+                if (data != null) {
+                    buf.append("binary[");
+                    buf.append(data.length);
+                    buf.append("];\n");
+                } else
+                    buf.append("null;\n");
+
                 buf.append("}\n");
                 return buf.toString();
             }
         }
 
-        public static class connected extends Reply {
-            static final long serialVersionUID = -16502658L;
-            public int server_version;
+        public static class pipeline extends Reply {
+            static final long serialVersionUID = -1341073418L;
+            public int codec;
+            public int lossless_codec;
+            public int max_fps;
 
-            public connected()
+            public pipeline()
             {
-                server_version = 0;
+                codec = 0;
+                lossless_codec = 0;
+                max_fps = 0;
             }
 
             public void deliverTo(Receiver r)
@@ -1370,8 +5366,8 @@ public abstract class broadcast implements java.io.Serializable {
                 // Message name
 
                 out.writeByte(18);
-                out.writeByte(-128);
-                out.writeByte(-126);
+                out.writeByte(-109);
+                out.writeByte(-31);
 
                 // Message
 
@@ -1394,8 +5390,8 @@ public abstract class broadcast implements java.io.Serializable {
                 // Message name
 
                 out.put((byte)18);
-                out.put((byte)-128);
-                out.put((byte)-126);
+                out.put((byte)-109);
+                out.put((byte)-31);
 
                 // Message
 
@@ -1404,10 +5400,12 @@ public abstract class broadcast implements java.io.Serializable {
 
             public boolean equals(Object _o)
             {
-                if (_o instanceof connected) {
-                    connected o = (connected) _o;
+                if (_o instanceof pipeline) {
+                    pipeline o = (pipeline) _o;
 
-                    return server_version == o.server_version;
+                    return codec == o.codec && 
+                        lossless_codec == o.lossless_codec && 
+                        max_fps == o.max_fps;
                 }
 
                 return false;
@@ -1415,15 +5413,25 @@ public abstract class broadcast implements java.io.Serializable {
 
             public int hashCode()
             {
-                return server_version;
+                return codec + 
+                        lossless_codec + 
+                        max_fps;
             }
 
             public java.lang.String toString()
             {
-                StringBuilder buf = new StringBuilder("Reply connected {\n");
+                StringBuilder buf = new StringBuilder("Reply pipeline {\n");
 
-                buf.append("    int32 server_version = ");
-                buf.append(server_version);
+                buf.append("    int32 codec = ");
+                buf.append(codec);
+                buf.append(";\n");
+
+                buf.append("    int32 lossless_codec = ");
+                buf.append(lossless_codec);
+                buf.append(";\n");
+
+                buf.append("    int32 max_fps = ");
+                buf.append(max_fps);
                 buf.append(";\n");
 
                 buf.append("}\n");
@@ -1431,21 +5439,19 @@ public abstract class broadcast implements java.io.Serializable {
             }
         }
 
-        public static class frame extends Reply {
-            static final long serialVersionUID = -2055670749L;
+        public static class viewport extends Reply {
+            static final long serialVersionUID = 1458910748L;
             public long timestamp_ns;
-            public int flags;
-            public int w;
-            public int h;
-            public byte[] data;
+            public long pose_timestamp_ns;
+            public int x;
+            public int y;
 
-            public frame()
+            public viewport()
             {
                 timestamp_ns = 0;
-                flags = 0;
-                w = 0;
-                h = 0;
-                data = new byte[0];
+                pose_timestamp_ns = 0;
+                x = 0;
+                y = 0;
             }
 
             public void deliverTo(Receiver r)
@@ -1469,8 +5475,8 @@ public abstract class broadcast implements java.io.Serializable {
                 // Message name
 
                 out.writeByte(18);
-                out.writeByte(-127);
-                out.writeByte(-117);
+                out.writeByte(73);
+                out.writeByte(68);
 
                 // Message
 
@@ -1493,8 +5499,8 @@ public abstract class broadcast implements java.io.Serializable {
                 // Message name
 
                 out.put((byte)18);
-                out.put((byte)-127);
-                out.put((byte)-117);
+                out.put((byte)73);
+                out.put((byte)68);
 
                 // Message
 
@@ -1503,14 +5509,13 @@ public abstract class broadcast implements java.io.Serializable {
 
             public boolean equals(Object _o)
             {
-                if (_o instanceof frame) {
-                    frame o = (frame) _o;
+                if (_o instanceof viewport) {
+                    viewport o = (viewport) _o;
 
                     return timestamp_ns == o.timestamp_ns && 
-                        flags == o.flags && 
-                        w == o.w && 
-                        h == o.h && 
-                        broadcast.equals(data, o.data);
+                        pose_timestamp_ns == o.pose_timestamp_ns && 
+                        x == o.x && 
+                        y == o.y;
                 }
 
                 return false;
@@ -1519,40 +5524,31 @@ public abstract class broadcast implements java.io.Serializable {
             public int hashCode()
             {
                 return (new Long(timestamp_ns).hashCode()) + 
-                        flags + 
-                        w + 
-                        h + 
-                        java.util.Arrays.hashCode(data);
+                        (new Long(pose_timestamp_ns).hashCode()) + 
+                        x + 
+                        y;
             }
 
             public java.lang.String toString()
             {
-                StringBuilder buf = new StringBuilder("Reply frame {\n");
+                StringBuilder buf = new StringBuilder("Reply viewport {\n");
 
                 buf.append("    int64 timestamp_ns = ");
                 buf.append(timestamp_ns);
                 buf.append(";\n");
 
-                buf.append("    int32 flags = ");
-                buf.append(flags);
+                buf.append("    int64 pose_timestamp_ns = ");
+                buf.append(pose_timestamp_ns);
                 buf.append(";\n");
 
-                buf.append("    int32 w = ");
-                buf.append(w);
+                buf.append("    int32 x = ");
+                buf.append(x);
                 buf.append(";\n");
 
-                buf.append("    int32 h = ");
-                buf.append(h);
+                buf.append("    int32 y = ");
+                buf.append(y);
                 buf.append(";\n");
 
-                buf.append("    binary data = ");
-                if (data != null) {
-                    buf.append("binary[");
-                    buf.append(data.length);
-                    buf.append("];\n");
-                } else
-                    buf.append("null;\n");
-
                 buf.append("}\n");
                 return buf.toString();
             }
@@ -36,22 +36,30 @@ openmp {
 SOURCES += \
         brcconnection.cpp \
         brcserver.cpp \
+        frame_encoder.cpp \
         main.cpp \
         mainwindow.cpp
 
 HEADERS += \
         brcconnection.h \
         brcserver.h \
+        encoder_settings.h \
+        frame_codec.h \
+        frame_encoder.h \
+        jpeg_out.hpp \
         mainwindow.h \
         offset_iter.h \
         pixels.h \
-        png_out.hpp
+        png_out.hpp \
+        qoi.hpp \
+        reply_out.h \
+        video_region.h
 
 FORMS += \
         mainwindow.ui
 
 
-LIBS += -lpthread
+LIBS += -lpthread -ljpeg
 
 QMAKE_CXXFLAGS +=  -pipe -std=c++17 -Wall -frtti -fexceptions -Werror=return-type -Werror=overloaded-virtual
 QMAKE_CXXFLAGS +=  -Wctor-dtor-privacy -Werror=delete-non-virtual-dtor -fno-strict-aliasing
@@ -1,34 +1,48 @@
 #include "brcconnection.h"
 #include "brcserver.h"
 #include "broadcast.h"
+#include "span_codec.h"
 #include "cm_ctors.h"
 #include "server_version.h"
 #include "ScreenCapture.h"
-#include "spinlock.h"
-#include "guard_on.h"
-#include "strutils.h"
 #include <chrono>
-#include "png_out.hpp"
+#include <deque>
+#include <poll.h>
 #include "pixels.h"
+#include "frame_codec.h"
+#include "encoder_settings.h"
+#include "reply_out.h"
+#include "frame_encoder.h"
 
 //--------------------------------------------------------------------------------------------------------
 using namespace protocol::broadcast;
 
-using SocketWriteLock = spinlock;
-using ImageVector     = std::vector<uint8_t>;
-
-constexpr static int32_t IMAGE_NOFLAGS = 0;
-constexpr static int32_t IMAGE_DELTA   = 1;
-constexpr static int32_t IMAGE_PNG     = 2;
+//requests are small, longer one is treated as garbage
+constexpr static size_t MAX_REQUEST_SIZE = 64 * 1024;
+//keyframe is split into that many tiles at most for clients decoding in parallel
+constexpr static int MAX_DECODER_THREADS = 16;
+//largest downscale client may ask for
+constexpr static int MAX_SCALE = 16;
+//most stripes frame may be sent in, each is 16 lines at least
+constexpr static int MAX_SLICES = 16;
+//most reduced progressive preview
+constexpr static int MAX_PREVIEW_SCALE = 16;
+//cursor shapes remembered as sent, older ones are sent again when they come back
+constexpr static size_t MAX_SENT_CURSORS = 32;
+//reply::Error codes
+constexpr static int32_t ERROR_CODEC_NOT_DECLARED = 1;
+//connection thread sleeps that long when there is nothing to read or send
+constexpr static int IDLE_WAIT_MS = 2;
 
 // this holds requests from client according to protocol and basicaly is finite state machine
 class FromClientFsm : public protocol::broadcast::request::Receiver
 {
 
 private:
-    std::ostream& os;
     request::connect clientVersion;
-    SocketWriteLock& socket_write_lock;
+    ReplyOut out;
+    EncoderSettings settings;
+    FrameEncoder encoder{settings, out};
     std::shared_ptr<SL::Screen_Capture::IScreenCaptureManager> framgrabber;
 
 public:
@@ -38,185 +52,255 @@ public:
     {
         framgrabber.reset();
     }
-    explicit FromClientFsm(std::ostream& os, SocketWriteLock& socket_write_lock): os(os), socket_write_lock(socket_write_lock) {}
+    explicit FromClientFsm(std::ostream& os, SocketWriteLock& socket_write_lock): out(os, socket_write_lock)
+    {
+        out.setDrainedCallback([this]()
+        {
+            encoder.wakeUp();
+        });
+    }
 
 
 public:
     void handle(request::connect& msg) final
     {
         clientVersion = msg;
+        settings.version_client = msg.version_client;
+        settings.screen_width = msg.screen_width;
+        settings.screen_height = msg.screen_height;
 
         reply::connected rply;
         rply.server_version = SERVER_INT_VERSION;
-
-        {
-            LOCK_GUARD_ON(socket_write_lock);
-            rply.marshal(os);
-            had_write = true;
-        }
+        out.send(rply);
 
         std::cout << "Client: " << msg.version_client << ", (" << msg.screen_width << " x " << msg.screen_height << ")" << std::endl;
 
         startGrab();
     }
 
-    bool hadWriteCallLocked()
+    void handle(request::frame_format& msg) final
     {
-        bool r = had_write;
-        had_write = false;
-        return r;
+        setFrameFormat(msg.codec, msg.quality);
     }
-private:
-    bool had_write{false};
-    std::chrono::steady_clock::time_point started_at{now()};
 
-    static std::chrono::steady_clock::time_point now()
+    //applied by frame thread to the next frame, capture keeps running
+    void handle(request::tune& msg) final
     {
-        using namespace std::chrono;
-        return steady_clock::now();
+        if (msg.max_fps >= 0)
+            settings.max_fps = msg.max_fps;
+        if (msg.scale >= 0)
+            settings.requested_scale = std::min(MAX_SCALE, msg.scale);
+        if (msg.codec >= 0 || msg.quality >= 0)
+            setFrameFormat((msg.codec >= 0) ? msg.codec : settings.requested_codec.load(),
+                           (msg.quality >= 0) ? msg.quality : settings.jpeg_quality.load());
+        std::cout << "Client tune: fps " << settings.max_fps << ", scale " << settings.requested_scale << std::endl;
     }
 
-    int64_t elapsed() const
+    void handle(request::pixel_format& msg) final
     {
-        using namespace std::chrono;
-        return duration_cast<nanoseconds>(now() - started_at).count();
+        using namespace pixel_format;
+        const bool known = msg.format >= static_cast<int32_t>(RawFormat::RGB888) &&
+                           msg.format <= static_cast<int32_t>(RawFormat::BGRX8888);
+        settings.raw_format = (known) ? static_cast<RawFormat>(msg.format) : RawFormat::RGB888;
     }
 
-    void startGrab()
+    void handle(request::ack& msg) final
     {
-        auto frame_new = std::make_shared<reply::frame>();
-
+        settings.acked_frame = msg.timestamp_ns;
+    }
 
-        framgrabber = SL::Screen_Capture::CreateCaptureConfiguration([this]()
-        {
-            auto windows = SL::Screen_Capture::GetWindows();
-            std::string srchterm = utility::toLower(clientVersion.win_caption);
-            decltype(windows) filtereditems;
-            for (const auto &a : windows)
-            {
-                std::string name = utility::toLower(a.Name);
-                if (utility::strcontains(name, srchterm))
-                {
-                    filtereditems.push_back(a);
-                    break;
-                }
-            }
-            started_at = now();
-            return filtereditems;
-        })->onFrameChanged([&](const SL::Screen_Capture::Image & img, const SL::Screen_Capture::Window &)
-        {
-            // std::cout << "Difference detected!  " << img.Bounds << std::endl;
-            //            auto r = realcounter.fetch_add(1);
-            //            auto s = std::to_string(r) + std::string("WINDIF_") + std::string(".jpg");
-            //            auto size = Width(img) * Height(img) * sizeof(SL::Screen_Capture::ImageBGRA);
-
-            /* auto imgbuffer(std::make_unique<unsigned char[]>(size));
-            ExtractAndConvertToRGBA(img, imgbuffer.get(), size);
-            tje_encode_to_file(s.c_str(), Width(img), Height(img), 4, (const unsigned char*)imgbuffer.get());
-            */
-        })->onNewFrame([this, frame_new](const SL::Screen_Capture::Image & img, const SL::Screen_Capture::Window &)
+    //picks the fastest pipeline client can decode, frame_format/pixel_format sent later override it
+    void handle(request::capabilities& msg) final
+    {
+        using namespace frame_codec;
+        using pixel_format::RawFormat;
+        const auto has = [&msg](int32_t codecs)
         {
-            frame_new->timestamp_ns = elapsed();
-            frame_new->flags = IMAGE_NOFLAGS;
-            ExtractAndConvertToBGRA(img, *frame_new);
+            return (msg.codecs & codecs) == codecs;
+        };
+        settings.client_codecs = msg.codecs;
+        settings.max_fps = std::max(0, msg.max_fps);
+        settings.decoder_threads = std::min(MAX_DECODER_THREADS, std::max(1, msg.decoder_threads));
+        //QOI encodes ~10 times faster than PNG
+        const int32_t lossless = (has(IMAGE_QOI)) ? IMAGE_QOI : IMAGE_PNG;
+        settings.lossless_codec = lossless;
+
+        //whole PNG frames are understood by any client
+        int32_t codec = IMAGE_PNG;
+        if (has(IMAGE_TILED | IMAGE_JPEG) && has(lossless))
+            codec = IMAGE_NOFLAGS;
+        else if (has(IMAGE_TILED | IMAGE_QOI))
+            codec = IMAGE_QOI;
+        else if (has(IMAGE_JPEG))
+            codec = IMAGE_JPEG;
+        settings.requested_codec = codec;
+        //capture buffer as is costs nothing
+        if (msg.pixel_formats & (1 << static_cast<int>(RawFormat::BGRX8888)))
+            settings.raw_format = RawFormat::BGRX8888;
+
+        reply::pipeline rply;
+        rply.codec = codec;
+        rply.lossless_codec = lossless;
+        rply.max_fps = settings.max_fps;
+        out.send(rply);
+        std::cout << "Client capabilities: " << msg.codecs << ", pipeline " << codec << ", lossless " << lossless << std::endl;
+    }
 
-            LOCK_GUARD_ON(socket_write_lock);
-            frame_new->marshal(os);
-            had_write = true;
+    void handle(request::slicing& msg) final
+    {
+        settings.slice_count = std::min(MAX_SLICES, std::max(0, msg.slices));
+        std::cout << "Client slices: " << settings.slice_count << std::endl;
+    }
 
-        })->start_capturing();
+    void handle(request::progressive& msg) final
+    {
+        //power of 2, so each layer is exactly 2 times sharper
+        int scale = 1;
+        while (scale * 2 <= std::min(MAX_PREVIEW_SCALE, msg.preview_scale))
+            scale *= 2;
+        settings.preview_scale = scale;
+        std::cout << "Client preview scale: " << scale << std::endl;
     }
 
+    void handle(request::foveation& msg) final
+    {
+        settings.fovea_eyes = std::min(2, std::max(1, msg.eyes));
+        settings.fovea_percent = std::min(100, std::max(10, msg.fovea_percent));
+        settings.periphery_scale = std::min(MAX_PREVIEW_SCALE, std::max(1, msg.periphery_scale));
+        std::cout << "Client foveation: " << settings.fovea_eyes << " eyes, fovea " << settings.fovea_percent
+                  << "%, periphery scale " << settings.periphery_scale << std::endl;
+    }
 
-    void ExtractAndConvertToBGRA(const SL::Screen_Capture::Image &img, reply::frame& dst) const
+    void handle(request::stereo& msg) final
     {
-        using namespace pixel_format;
-        using namespace SL::Screen_Capture;
+        settings.stereo_layout = (msg.layout == 1) ? 1 : 0;
+        std::cout << "Client stereo layout: " << settings.stereo_layout << std::endl;
+    }
 
-        const size_t w = Width(img);
-        const size_t h = Height(img);
-        const size_t pixel_count = w * h;
+    void handle(request::pose& msg) final
+    {
+        settings.setPose(EncoderSettings::Pose{msg.timestamp_ns, msg.yaw, msg.pitch, msg.fov_x, msg.fov_y, msg.view_w, msg.view_h});
+    }
 
-        static_assert(sizeof(ImageBGRA) == 4, "Expecting 4 bytes/pixel!");
-        pools::PooledVector<uint8_t> rgb;
-        rgb.resize(pixel_count * 3);
+    void handle(request::chunking& msg) final
+    {
+        const size_t size = (msg.chunk_size > 0) ? std::max(ReplyOut::MIN_CHUNK_SIZE, static_cast<size_t>(msg.chunk_size)) : 0;
+        out.setChunkSize(size);
+        std::cout << "Client chunk size: " << size << std::endl;
+    }
 
-        //extracting BGRA image to RGB vector
-        auto startsrc = StartSrc(img);
-        const auto cast_src = [&startsrc]()
+    template <class Predicate>
+    bool flush(boost::asio::streambuf& buffer, const network::SocketPtr& socket, Predicate& should_break)
+    {
+        return out.flush(buffer, socket, should_break);
+    }
+private:
+    //cursor is sent by own thread of the grabber, those are touched by it only;
+    //serials of sent shapes, most recently used last
+    std::deque<int64_t> sent_cursors;
+    reply::cursor_shape cursor_shape;
+    reply::cursor_pos cursor_pos;
+
+    //unknown codec or one which needs codecs client did not declare in capabilities is refused with Error,
+    //previous one stays then
+    void setFrameFormat(int32_t codec, int quality)
+    {
+        using namespace frame_codec;
+        const bool known = codec == IMAGE_NOFLAGS || codec == IMAGE_PNG || codec == IMAGE_JPEG || codec == IMAGE_QOI ||
+                           codec == IMAGE_XOR || codec == IMAGE_RAW;
+        const int32_t declared = settings.client_codecs;
+        const int32_t needed = (known) ? settings.neededCodecs(codec) : 0;
+        if (!known || (declared >= 0 && (declared & needed) != needed))
         {
-            uint8_t *p;
-            memcpy(&p, &startsrc, sizeof(void*));
-            return p;
-        };
-
-        if (isDataContiguous(img))
-            convertBGRA8888_to_RGB888(Iterator8888::start(cast_src(), pixel_count), pixel_count,
-                                      Iterator888::start(rgb, pixel_count));
+            reply::Error err;
+            err.code = ERROR_CODEC_NOT_DECLARED;
+            err.message = (known) ? "Codec " + std::to_string(codec) + " needs " + std::to_string(needed) +
+                          ", client capabilities are " + std::to_string(declared) : "Unknown codec " + std::to_string(codec);
+            out.send(err);
+            std::cerr << err.message << std::endl;
+        }
         else
+            settings.requested_codec = codec;
+        settings.jpeg_quality = std::min(100, std::max(0, quality));
+        std::cout << "Client frame format: " << settings.requested_codec << ", quality " << settings.jpeg_quality << std::endl;
+    }
+
+    void startGrab()
+    {
+        auto config = SL::Screen_Capture::CreateCaptureConfiguration([this]()
+        {
+            auto filtereditems = SL::Screen_Capture::FindWindows(clientVersion.win_caption);
+            encoder.restartClock();
+            return filtereditems;
+        })->onFrameChanged([this](const SL::Screen_Capture::Image & img, const SL::Screen_Capture::Window &)
+        {
+            //must be set, otherwise library does not compare frames and isChanged() is always true
+            //called before onNewFrame of the same frame
+            encoder.changed(img);
+        })->onNewFrame([this](const SL::Screen_Capture::Image & img, const SL::Screen_Capture::Window &)
+        {
+            encoder.encode(img);
+        });
+
+        const bool with_cursor = settings.extraReplies();
+        if (with_cursor)
         {
-            //todo: this is not tested yet, as never happened
-            auto out = Iterator888::start(rgb, pixel_count);
-            for (size_t i = 0; i < h; ++i)
+            config->onMouseChanged([this](const SL::Screen_Capture::Image * img, const SL::Screen_Capture::MousePoint & mousepoint)
             {
-                out = convertBGRA8888_to_RGB888(Iterator8888::start(cast_src(), w), w, out);
-                startsrc = GotoNextRow(img, startsrc);      // advance to the next row
-            }
+                sendCursor(img, mousepoint);
+            });
         }
+        framgrabber = config->start_capturing();
+        encoder.setGrabber(framgrabber.get());
+        //static screen is polled up to 8 times slower, cursor activity or any change restores rate
+        framgrabber->setIdleBackoff(8);
+        //cursor thread sleeps until pointer moves or shape changes, interval only limits rate of cursor_pos
+        if (with_cursor)
+            framgrabber->setMouseChangeInterval(std::chrono::milliseconds(20));
+    }
 
-        //checking if we can reduce image as destination has smaller screen
-        const int shrinkW = w / clientVersion.screen_width;
-        const int shrinkH = h / clientVersion.screen_height;
+    //true if shape of serial was sent and is still remembered, it becomes the most recent one
+    bool touchSentCursor(int64_t serial)
+    {
+        const auto it = std::find(sent_cursors.begin(), sent_cursors.end(), serial);
+        if (it == sent_cursors.end())
+            return false;
+        sent_cursors.erase(it);
+        sent_cursors.push_back(serial);
+        return true;
+    }
 
+    void sendCursor(const SL::Screen_Capture::Image *img, const SL::Screen_Capture::MousePoint& mousepoint)
+    {
+        using namespace SL::Screen_Capture;
+        const auto serial = static_cast<int64_t>(mousepoint.Serial);
 
-        const auto make_png = [&dst](const auto & src, int w, int h)
+        out.sendTogether([&](std::ostream& os)
         {
-            dst.w = w;
-            dst.h = h;
-            dst.flags |= IMAGE_PNG;
-
-            dst.data.clear();
-            dst.data.reserve(w * h * 3 + 100);
-            TinyPngOut png(w, h, [&dst](const uint8_t* src, size_t sz)
+            if (img && !touchSentCursor(serial))
             {
-                std::copy_n(src, sz, std::back_inserter(dst.data));
-            });
-            png.write(src);
-        };
-
+                cursor_shape.serial = serial;
+                cursor_shape.hot_x = mousepoint.HotSpot.x;
+                cursor_shape.hot_y = mousepoint.HotSpot.y;
+                cursor_shape.w = Width(*img);
+                cursor_shape.h = Height(*img);
+                cursor_shape.data.resize(cursor_shape.w * cursor_shape.h * sizeof(ImageBGRA));
+                Extract(*img, cursor_shape.data.data(), cursor_shape.data.size());
+                for (size_t i = 0, sz = cursor_shape.data.size(); i < sz; i += sizeof(ImageBGRA))
+                    std::swap(cursor_shape.data[i], cursor_shape.data[i + 2]); //BGRA -> RGBA
+                cursor_shape.marshal(os);
+                sent_cursors.push_back(serial);
+                if (sent_cursors.size() > MAX_SENT_CURSORS)
+                    sent_cursors.pop_front();
+            }
 
-        if (shrinkW > 1 || shrinkH > 1)
-        {
-            //need to shrink image
-            //TODO: NOT TESTED! cannot run on my device yet as it's almost same as monitor resolution
-            size_t nw = w / shrinkW;
-            size_t nh = h / shrinkH;
-            const size_t pixel_count = nw * nh;
-            pools::PooledVector<uint8_t> rgb2;
-            rgb2.resize(pixel_count * 3);
-            auto out = Iterator888::start(rgb2, pixel_count);
-
-            for (size_t j = 0; j < h; j += shrinkH)
-                for (size_t i = 0; i < w; i += shrinkW)
-                {
-                    PixelAvr<uint8_t, 3> avr;
-                    for (int k = 0; k < shrinkH; ++k)
-                    {
-                        const auto srcw(Iterator888::start(rgb.data() + (j + k) * w + i, pixel_count));
-                        ALG_NS::for_each(OffsetIterator(0), OffsetIterator(shrinkW), [&srcw, &avr](size_t x)
-                        {
-                            avr.add(srcw[x]);
-                        });
-                    }
-                    out = avr;
-                    ++out;
-                }
-            make_png(rgb2, nw, nh);
-        }
-        else
-            make_png(rgb, w, h);
+            const auto pos = encoder.toFramePixels(mousepoint.Position.x, mousepoint.Position.y);
+            cursor_pos.serial = serial;
+            cursor_pos.x = pos.first;
+            cursor_pos.y = pos.second;
+            cursor_pos.marshal(os);
+        });
     }
-
 };
 
 //--------------------------------------------------------------------------------------------------------
@@ -231,6 +315,38 @@ BrcConnection::BrcConnection(const network::SocketPtr &socket):
 {
 }
 
+//delivers all complete requests which parser has got so far
+static void deliverRequests(protocol::span::Parser& parser, FromClientFsm& fsm)
+{
+    using namespace protocol::span;
+    MessageView msg;
+    bool malformed = false;
+    for (Status s; (s = parser.next(msg)) != Status::Incomplete;)
+    {
+        if (s == Status::Malformed)
+        {
+            malformed = true;
+            continue;
+        }
+        const auto req = makeRequest(msg);
+        if (!req)
+        {
+            std::cerr << "Unknown request " << msg.id << " skipped." << std::endl;
+            continue;
+        }
+        try
+        {
+            req->deliverTo(fsm);
+        }
+        catch (std::exception& e)
+        {
+            std::cerr << "Request " << msg.id << " failed: " << e.what() << std::endl;
+        }
+    }
+    if (malformed)
+        std::cerr << "Malformed request data skipped." << std::endl;
+}
+
 void BrcConnection::start()
 {
     using namespace protocol::broadcast;
@@ -252,24 +368,23 @@ void BrcConnection::start()
                 };
 
 
+                //requests may come in pieces, socket is read only for bytes which are already there
+                protocol::span::Parser parser(MAX_REQUEST_SIZE);
                 while (!should_break_loop())
                 {
                     const auto readable = network::readableBytes(socket); //debuger friendly
-                    if (readable > 5)
+                    if (readable)
                     {
-                        try
-                        {
-                            network::sock_iostream is(*socket);
-                            request::Base::unmarshal(is)->deliverTo(fsm);
-                        }
-                        catch (...)
-                        {
-                        }
+                        parser.commit(socket->receive(boost::asio::buffer(parser.prepare(readable), readable)));
+                        deliverRequests(parser, fsm);
                     }
 
-                    lock_guard_conditional grd(socket_write_lock, should_break_loop);
-                    if (grd.isLocked() && fsm.hadWriteCallLocked())
-                        network::writeToSocket(out_buffer, socket);
+                    //nothing to do: waits for request bytes a little, replies written meanwhile wait that long at most
+                    if (!fsm.flush(out_buffer, socket, should_break_loop) && !readable)
+                    {
+                        pollfd pfd{socket->native_handle(), POLLIN, 0};
+                        poll(&pfd, 1, IDLE_WAIT_MS);
+                    }
                 }
             }
         }
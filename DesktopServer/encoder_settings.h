@@ -0,0 +1,121 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <algorithm>
+#include "spinlock.h"
+#include "guard_on.h"
+#include "pixels.h"
+#include "frame_codec.h"
+
+//lowest client version which understands cursor_shape/cursor_pos/tick replies and IMAGE_TILED frames
+constexpr static int32_t CLIENT_VERSION_EXTRA_REPLIES = 2;
+
+//Pipeline knobs: written by connection thread as client requests come, read by frame thread for each frame.
+//Client's version and screen are set by request::connect before capture starts and stay.
+struct EncoderSettings
+{
+    int32_t version_client{0};
+    int32_t screen_width{0};
+    int32_t screen_height{0};
+
+    //set by request::frame_format, 0 means server decides
+    std::atomic<int32_t> requested_codec{frame_codec::IMAGE_NOFLAGS};
+    std::atomic<int> jpeg_quality{0};
+    //set by request::pixel_format
+    std::atomic<pixel_format::RawFormat> raw_format{pixel_format::RawFormat::RGB888};
+    //set by request::capabilities, client_codecs -1 means version_client decides
+    std::atomic<int32_t> client_codecs{-1};
+    std::atomic<int32_t> lossless_codec{frame_codec::IMAGE_PNG};
+    std::atomic<int> max_fps{0};
+    std::atomic<int> decoder_threads{1};
+    //set by request::tune, 0 - shrink is derived from client's screen size
+    std::atomic<int> requested_scale{0};
+    //set by request::slicing, 0 or 1 - whole frames
+    std::atomic<int> slice_count{0};
+    //set by request::progressive, 1 - tiles go in full resolution at once
+    std::atomic<int> preview_scale{1};
+    //set by request::foveation, periphery_scale 1 - off
+    std::atomic<int> fovea_eyes{1};
+    std::atomic<int> fovea_percent{100};
+    std::atomic<int> periphery_scale{1};
+    //set by request::stereo, 1 - side by side
+    std::atomic<int> stereo_layout{0};
+    //set by request::ack
+    std::atomic<int64_t> acked_frame{0};
+
+    //latest request::pose, view_w 0 - frames are whole picture
+    struct Pose
+    {
+        int64_t timestamp_ns{0};
+        int32_t yaw{0};
+        int32_t pitch{0};
+        int32_t fov_x{0};
+        int32_t fov_y{0};
+        int32_t view_w{0};
+        int32_t view_h{0};
+    };
+
+    Pose pose() const
+    {
+        LOCK_GUARD_ON(pose_lock);
+        return current_pose;
+    }
+
+    void setPose(const Pose& p)
+    {
+        LOCK_GUARD_ON(pose_lock);
+        current_pose = p;
+    }
+
+    bool extraReplies() const
+    {
+        return version_client >= CLIENT_VERSION_EXTRA_REPLIES;
+    }
+
+    int jpegQuality(int server_default) const
+    {
+        const int q = jpeg_quality;
+        return (q > 0) ? q : server_default;
+    }
+
+    //client which told its codecs may not know IMAGE_TILED
+    bool clientTiles() const
+    {
+        const int32_t codecs = client_codecs;
+        return extraReplies() && (codecs < 0 || (codecs & frame_codec::IMAGE_TILED));
+    }
+
+    bool tiledFrames(int32_t codec) const
+    {
+        return codec != frame_codec::IMAGE_JPEG && clientTiles();
+    }
+
+    //IMAGE_* bits client must decode to get frames of frame_format codec: codec 0 mixes JPEG and lossless tiles,
+    //IMAGE_XOR adds QOI tiles when there is no reference, tile codecs become whole PNG frames without tiles
+    int32_t neededCodecs(int32_t codec) const
+    {
+        using namespace frame_codec;
+        if (codec == IMAGE_JPEG)
+            return IMAGE_JPEG;
+        if (!clientTiles())
+            return IMAGE_PNG;
+        const int32_t mixed = IMAGE_TILED | IMAGE_JPEG | lossless_codec;
+        if (codec == IMAGE_NOFLAGS)
+            return mixed;
+        if (codec == IMAGE_XOR)
+            return mixed | IMAGE_XOR | IMAGE_QOI;
+        return IMAGE_TILED | codec;
+    }
+
+    //wanted interval limited by client's max_fps
+    std::chrono::milliseconds frameInterval(std::chrono::milliseconds wanted) const
+    {
+        const int fps = max_fps;
+        return (fps > 0) ? std::max(wanted, std::chrono::milliseconds(1000 / fps)) : wanted;
+    }
+
+private:
+    mutable spinlock pose_lock;
+    Pose current_pose;
+};
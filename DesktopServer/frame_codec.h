@@ -0,0 +1,443 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
+#include "png_out.hpp"
+#include "jpeg_out.hpp"
+#include "qoi.hpp"
+#include "cm_ctors.h"
+
+//building blocks for reply::frame::data, wire layouts are described in broadcast.proto
+namespace frame_codec
+{
+    //bit flags for frame.flags
+    constexpr static int32_t IMAGE_NOFLAGS = 0;
+    constexpr static int32_t IMAGE_DELTA   = 1;
+    constexpr static int32_t IMAGE_PNG     = 2;
+    constexpr static int32_t IMAGE_TILED   = 4;
+    constexpr static int32_t IMAGE_JPEG    = 8;
+    constexpr static int32_t IMAGE_QOI     = 16;
+    constexpr static int32_t IMAGE_XOR     = 32;
+    constexpr static int32_t IMAGE_RAW     = 64;
+    constexpr static int32_t IMAGE_SLICE   = 128;
+    constexpr static int32_t IMAGE_COPY    = 256;
+
+    struct Rect
+    {
+        int x{0};
+        int y{0};
+        int w{0};
+        int h{0};
+
+        bool empty() const
+        {
+            return w <= 0 || h <= 0;
+        }
+
+        bool operator==(const Rect& o) const
+        {
+            return x == o.x && y == o.y && w == o.w && h == o.h;
+        }
+
+        int right() const
+        {
+            return x + w;
+        }
+
+        int bottom() const
+        {
+            return y + h;
+        }
+
+        bool contains(const Rect& o) const
+        {
+            return !empty() && x <= o.x && y <= o.y && right() >= o.right() && bottom() >= o.bottom();
+        }
+
+        Rect united(const Rect& o) const
+        {
+            if (empty())
+                return o;
+            if (o.empty())
+                return *this;
+            const int l = std::min(x, o.x);
+            const int t = std::min(y, o.y);
+            return Rect{l, t, std::max(right(), o.right()) - l, std::max(bottom(), o.bottom()) - t};
+        }
+
+        Rect intersected(const Rect& o) const
+        {
+            const int l = std::max(x, o.x);
+            const int t = std::max(y, o.y);
+            const Rect r{l, t, std::min(right(), o.right()) - l, std::min(bottom(), o.bottom()) - t};
+            return (r.empty()) ? Rect() : r;
+        }
+
+        Rect moved(int dx, int dy) const
+        {
+            return Rect{x + dx, y + dy, w, h};
+        }
+
+        //rect in image reduced by sx/sy times, all touched pixels are kept
+        Rect shrinked(int sx, int sy) const
+        {
+            const int l = x / sx;
+            const int t = y / sy;
+            return Rect{l, t, (right() + sx - 1) / sx - l, (bottom() + sy - 1) / sy - t};
+        }
+    };
+
+    //calls callback for up to 4 rectangles which cover r except the hole
+    template <class Callback>
+    void forEachOutside(const Rect& r, const Rect& hole, const Callback& callback)
+    {
+        const auto inner = r.intersected(hole);
+        if (inner.empty())
+        {
+            callback(r);
+            return;
+        }
+        const Rect parts[] =
+        {
+            {r.x, r.y, r.w, inner.y - r.y},
+            {r.x, inner.y, inner.x - r.x, inner.h},
+            {inner.right(), inner.y, r.right() - inner.right(), inner.h},
+            {r.x, inner.bottom(), r.w, r.bottom() - inner.bottom()},
+        };
+        for (const auto& p : parts)
+            if (!p.empty())
+                callback(p);
+    }
+
+    //true when area r of RGB888 image which has src_w pixels per line equals the same size area at x, y
+    template <class Src>
+    bool sameArea(const Src& rgb, int src_w, const Rect& r, int x, int y)
+    {
+        const size_t line = static_cast<size_t>(r.w) * 3;
+        for (int j = 0; j < r.h; ++j)
+            if (std::memcmp(rgb.data() + (static_cast<size_t>(r.y + j) * src_w + r.x) * 3,
+                            rgb.data() + (static_cast<size_t>(y + j) * src_w + x) * 3, line))
+                return false;
+        return true;
+    }
+
+    //IMAGE_COPY payload
+    inline void appendCopySource(int x, int y, std::vector<uint8_t>& out)
+    {
+        for (const auto v : {x, y})
+            for (int shift = 24; shift >= 0; shift -= 8)
+                out.push_back(static_cast<uint8_t>(static_cast<uint32_t>(v) >> shift));
+    }
+
+    //copies rectangle out of RGB888 image which has src_w pixels per line
+    template <class Src, class Dst>
+    void cropRGB(const Src& src, int src_w, const Rect& r, Dst& dst)
+    {
+        const size_t line = static_cast<size_t>(r.w) * 3;
+        dst.resize(line * r.h);
+        for (int j = 0; j < r.h; ++j)
+            std::copy_n(src.data() + (static_cast<size_t>(r.y + j) * src_w + r.x) * 3, line, dst.data() + line * j);
+    }
+
+    //Indexes RGB888 pixels when there are at most 256 distinct colors, gives up as soon as 257th is met.
+    //Palette is RGB triplets in order of appearance.
+    class PaletteIndexer
+    {
+    private:
+        constexpr static size_t SLOTS = 1024; //power of 2, load factor stays under 1/4
+        uint32_t keys[SLOTS];                 //color + 1, 0 is empty slot
+        uint8_t values[SLOTS];
+        uint32_t last_key{0};
+        uint8_t last_value{0};
+
+    public:
+        std::vector<uint8_t> palette;
+        std::vector<uint8_t> indexes;
+
+        bool index(const uint8_t* rgb, size_t count)
+        {
+            std::fill(std::begin(keys), std::end(keys), 0);
+            palette.clear();
+            indexes.resize(count);
+            last_key = 0;
+            for (size_t i = 0; i < count; ++i, rgb += 3)
+            {
+                const uint32_t key = ((static_cast<uint32_t>(rgb[0]) << 16) | (rgb[1] << 8) | rgb[2]) + 1;
+                //neighbour pixels are mostly the same
+                if (key != last_key)
+                {
+                    size_t slot = (key * 2654435761u) >> 22;
+                    for (; keys[slot] && keys[slot] != key; slot = (slot + 1) & (SLOTS - 1));
+                    if (!keys[slot])
+                    {
+                        if (palette.size() == 256 * 3)
+                            return false;
+                        keys[slot] = key;
+                        values[slot] = static_cast<uint8_t>(palette.size() / 3);
+                        palette.insert(palette.end(), rgb, rgb + 3);
+                    }
+                    last_key = key;
+                    last_value = values[slot];
+                }
+                indexes[i] = last_value;
+            }
+            return true;
+        }
+    };
+
+    //appends PNG of RGB888 image w x h, low color pictures (UI, text, terminals) go as palette PNG 3 times smaller
+    template <class Src>
+    void appendPng(const Src& rgb, int w, int h, std::vector<uint8_t>& out)
+    {
+        const auto writer = [&out](const uint8_t* src, size_t sz)
+        {
+            out.insert(out.end(), src, src + sz);
+        };
+        const size_t count = static_cast<size_t>(w) * h;
+
+        PaletteIndexer indexer;
+        if (indexer.index(rgb.data(), count))
+        {
+            out.reserve(out.size() + count + indexer.palette.size() + 100);
+            TinyPngOut png(w, h, writer, indexer.palette.data(), indexer.palette.size() / 3);
+            png.write(indexer.indexes);
+            return;
+        }
+
+        out.reserve(out.size() + count * 3 + 100);
+        TinyPngOut png(w, h, writer);
+        png.write(rgb);
+    }
+
+    //appends QOI of RGB888 image w x h, lossless as PNG but many times faster
+    template <class Src>
+    void appendQoi(const Src& rgb, int w, int h, std::vector<uint8_t>& out)
+    {
+        qoi::encode(rgb.data(), w, h, static_cast<size_t>(w) * 3, out);
+    }
+
+    inline void appendVarint(uint64_t v, std::vector<uint8_t>& out)
+    {
+        for (; v > 0x7F; v >>= 7)
+            out.push_back(static_cast<uint8_t>(v | 0x80));
+        out.push_back(static_cast<uint8_t>(v));
+    }
+
+    //IMAGE_XOR payload: big endian int64 timestamp of reference frame, then cur ^ ref as
+    //pairs of varints (zero bytes count, literal bytes count) each followed by literal bytes
+    template <class Cur, class Ref>
+    void appendXorDelta(const Cur& cur, const Ref& ref, int64_t ref_timestamp, std::vector<uint8_t>& out)
+    {
+        for (int shift = 56; shift >= 0; shift -= 8)
+            out.push_back(static_cast<uint8_t>(static_cast<uint64_t>(ref_timestamp) >> shift));
+
+        const size_t size = std::min(cur.size(), ref.size());
+        const uint8_t* a = cur.data();
+        const uint8_t* b = ref.data();
+        size_t i = 0;
+        while (i < size)
+        {
+            //unchanged bytes are skipped 8 at once
+            const size_t zeros_from = i;
+            for (; i + 8 <= size; i += 8)
+            {
+                uint64_t x;
+                uint64_t y;
+                std::memcpy(&x, a + i, 8);
+                std::memcpy(&y, b + i, 8);
+                if (x != y)
+                    break;
+            }
+            for (; i < size && a[i] == b[i]; ++i);
+
+            //literal lasts until 4 equal bytes in a row, shorter zero runs are cheaper inline
+            const size_t literal_from = i;
+            size_t equal = 0;
+            for (; i < size && equal < 4; ++i)
+                equal = (a[i] == b[i]) ? equal + 1 : 0;
+            if (equal >= 4)
+                i -= equal;
+
+            appendVarint(literal_from - zeros_from, out);
+            appendVarint(i - literal_from, out);
+            for (size_t k = literal_from; k < i; ++k)
+                out.push_back(a[k] ^ b[k]);
+        }
+    }
+
+    //reference decoder of IMAGE_XOR payload (without timestamp), applies it to ref in place
+    inline bool applyXorDelta(const uint8_t* data, size_t size, std::vector<uint8_t>& ref)
+    {
+        const uint8_t* end = data + size;
+        const auto varint = [&data, end](size_t& v)
+        {
+            v = 0;
+            for (int shift = 0; data < end && shift < 64; shift += 7)
+            {
+                const uint8_t b = *data++;
+                v |= static_cast<size_t>(b & 0x7F) << shift;
+                if (!(b & 0x80))
+                    return true;
+            }
+            return false;
+        };
+
+        size_t pos = 0;
+        while (data < end)
+        {
+            size_t zeros;
+            size_t literal;
+            if (!varint(zeros) || !varint(literal) || pos + zeros + literal > ref.size() ||
+                    static_cast<size_t>(end - data) < literal)
+                return false;
+            pos += zeros;
+            for (size_t k = 0; k < literal; ++k)
+                ref[pos++] ^= *data++;
+        }
+        return true;
+    }
+
+    //Picks codec for RGB888 area: UI and text (few colors, hard edges) must stay lossless,
+    //photos and video (many colors, smooth gradients) go to JPEG.
+    template <class Src>
+    int32_t classifyTile(const Src& rgb, int src_w, const Rect& r)
+    {
+        constexpr size_t MAX_LOSSLESS_COLORS = 64;
+        constexpr size_t TABLE_SIZE = 256; //power of 2, bigger then MAX_LOSSLESS_COLORS
+        constexpr int TABLE_BITS = 8;      //log2(TABLE_SIZE)
+        static_assert(TABLE_SIZE == 1u << TABLE_BITS, "TABLE_BITS must match TABLE_SIZE");
+        constexpr int SMOOTH_DIFF = 24;    //sum of |dR|+|dG|+|dB| of neighbours inside gradient
+        constexpr float MIN_SMOOTH = 0.3f; //part of smooth neighbours in natural image
+
+        //open addressing set of 24 bit colors, 0xFFFFFFFF is empty
+        uint32_t table[TABLE_SIZE];
+        std::fill_n(table, TABLE_SIZE, 0xFFFFFFFFu);
+        size_t colors = 0;
+        size_t smooth = 0;
+
+        for (int j = 0; j < r.h; ++j)
+        {
+            const uint8_t* line = rgb.data() + (static_cast<size_t>(r.y + j) * src_w + r.x) * 3;
+            for (int i = 0; i < r.w; ++i)
+            {
+                const uint8_t* p = line + i * 3;
+                if (colors <= MAX_LOSSLESS_COLORS)
+                {
+                    const uint32_t c = (static_cast<uint32_t>(p[0]) << 16) | (static_cast<uint32_t>(p[1]) << 8) | p[2];
+                    //multiplicative hash: high bits are mixed from all bits of color
+                    size_t h = (c * 2654435761u) >> (32 - TABLE_BITS);
+                    while (table[h] != 0xFFFFFFFFu && table[h] != c)
+                        h = (h + 1) & (TABLE_SIZE - 1);
+                    if (table[h] != c)
+                    {
+                        table[h] = c;
+                        ++colors;
+                    }
+                }
+                if (i > 0)
+                {
+                    const int d = std::abs(p[0] - p[-3]) + std::abs(p[1] - p[-2]) + std::abs(p[2] - p[-1]);
+                    smooth += (d > 0 && d < SMOOTH_DIFF) ? 1 : 0;
+                }
+            }
+        }
+
+        if (colors <= MAX_LOSSLESS_COLORS)
+            return IMAGE_PNG;
+        return (smooth >= MIN_SMOOTH * r.w * r.h) ? IMAGE_JPEG : IMAGE_PNG;
+    }
+
+    //splits area into blocks, classifies each and joins neighbours of the same codec in a row into one tile
+    template <class Src, class Callback>
+    void splitByContent(const Src& rgb, int src_w, const Rect& area, const Callback& callback)
+    {
+        constexpr int BLOCK = 64;
+        for (int y = area.y; y < area.bottom(); y += BLOCK)
+        {
+            const int bh = std::min(BLOCK, area.bottom() - y);
+            Rect run;
+            int32_t run_codec = IMAGE_NOFLAGS;
+            for (int x = area.x; x < area.right(); x += BLOCK)
+            {
+                const Rect block{x, y, std::min(BLOCK, area.right() - x), bh};
+                const auto codec = classifyTile(rgb, src_w, block);
+                if (!run.empty() && codec != run_codec)
+                {
+                    callback(run, run_codec);
+                    run = Rect();
+                }
+                run = run.united(block);
+                run_codec = codec;
+            }
+            if (!run.empty())
+                callback(run, run_codec);
+        }
+    }
+
+    //appends baseline JPEG of RGB888 image w x h, quality is 1 (lowest) .. 100 (highest)
+    //each thread keeps its own compressor; false means libjpeg failed and out is left as it was
+    inline bool appendJpeg(const uint8_t* rgb, int w, int h, int quality, std::vector<uint8_t>& out)
+    {
+        thread_local JpegOut jpeg;
+        return jpeg.encode(rgb, w, h, static_cast<size_t>(w) * 3, quality, out);
+    }
+
+    //IMAGE_TILED container: each tile is 7 big endian int32 (x, y, w, h, codec, scale, length) followed by payload
+    class TiledFrameWriter
+    {
+    private:
+        std::vector<uint8_t>& out;
+        size_t tiles{0};
+
+        void putInt(size_t pos, int32_t v)
+        {
+            const auto u = static_cast<uint32_t>(v);
+            out[pos + 0] = static_cast<uint8_t>(u >> 24);
+            out[pos + 1] = static_cast<uint8_t>(u >> 16);
+            out[pos + 2] = static_cast<uint8_t>(u >> 8);
+            out[pos + 3] = static_cast<uint8_t>(u);
+        }
+    public:
+        constexpr static size_t HEADER_SIZE = 7 * sizeof(int32_t);
+
+        TiledFrameWriter() = delete;
+        NO_COPYMOVE(TiledFrameWriter);
+        explicit TiledFrameWriter(std::vector<uint8_t>& out): out(out) {}
+
+        //rect is destination in frame pixels, encoder must append payload to vector passed to it;
+        //encoder which returns int32_t tells codec it really used (e.g. lossless one when JPEG failed)
+        template <class Encoder>
+        void add(const Rect& r, int32_t codec, int32_t scale, const Encoder& encoder)
+        {
+            const size_t hdr = out.size();
+            out.resize(hdr + HEADER_SIZE);
+            putInt(hdr, r.x);
+            putInt(hdr + 4, r.y);
+            putInt(hdr + 8, r.w);
+            putInt(hdr + 12, r.h);
+            putInt(hdr + 20, scale);
+            if constexpr (std::is_void<decltype(encoder(out))>::value)
+                encoder(out);
+            else
+                codec = encoder(out);
+            putInt(hdr + 16, codec);
+            putInt(hdr + 24, static_cast<int32_t>(out.size() - hdr - HEADER_SIZE));
+            ++tiles;
+        }
+
+        size_t count() const
+        {
+            return tiles;
+        }
+
+        //tiles of other writer, e.g. encoded by other thread meanwhile, go after these
+        void append(const TiledFrameWriter& other)
+        {
+            out.insert(out.end(), other.out.begin(), other.out.end());
+            tiles += other.tiles;
+        }
+    };
+}
@@ -0,0 +1,826 @@
+#include "frame_encoder.h"
+#include <thread>
+#include <iostream>
+#include "span_codec.h"
+
+//--------------------------------------------------------------------------------------------------------
+using namespace protocol::broadcast;
+
+using ImageVector = std::vector<uint8_t>;
+
+constexpr static auto FRAME_INTERVAL       = std::chrono::milliseconds(100);
+constexpr static auto VIDEO_FRAME_INTERVAL = std::chrono::milliseconds(33);
+//how often the rest of the screen is updated while video plays
+constexpr static auto BACKGROUND_INTERVAL  = std::chrono::milliseconds(500);
+constexpr static size_t MAX_BACKGROUND_TILES = 8;
+constexpr static int VIDEO_JPEG_QUALITY = 50;
+//pictures which are not video, user can look at them longer
+constexpr static int IMAGE_JPEG_QUALITY = 75;
+//how many video tiles are kept as possible IMAGE_XOR references, client keeps the same amount
+constexpr static size_t XOR_HISTORY = 8;
+//foveation periphery is barely seen
+constexpr static int PERIPHERY_JPEG_QUALITY = 30;
+//slice work of this many pixels is split between frame thread and worker
+constexpr static int64_t PARALLEL_MIN_PIXELS = 256 * 256;
+
+//worker would only take turns with frame thread on single core
+static const bool MULTICORE = std::thread::hardware_concurrency() > 1;
+
+static std::chrono::steady_clock::time_point now()
+{
+    using namespace std::chrono;
+    return steady_clock::now();
+}
+
+FrameEncoder::FrameEncoder(const EncoderSettings& settings, ReplyOut& out):
+    settings(settings),
+    out(out),
+    started_at(now())
+{
+}
+
+void FrameEncoder::setGrabber(SL::Screen_Capture::IScreenCaptureManager* grabber)
+{
+    frame_interval = settings.frameInterval(FRAME_INTERVAL);
+    grabber->setFrameChangeInterval(frame_interval);
+    grabber_ptr = grabber;
+}
+
+void FrameEncoder::wakeUp()
+{
+    auto grabber = grabber_ptr.load();
+    if (grabber)
+        grabber->notifyActivity();
+}
+
+void FrameEncoder::restartClock()
+{
+    started_at = now();
+}
+
+int64_t FrameEncoder::elapsed() const
+{
+    using namespace std::chrono;
+    return duration_cast<nanoseconds>(now() - started_at).count();
+}
+
+void FrameEncoder::changed(const SL::Screen_Capture::Image& img)
+{
+    using namespace SL::Screen_Capture;
+    frame_dirty.push_back(frame_codec::Rect{OffsetX(img), OffsetY(img), Width(img), Height(img)});
+}
+
+void FrameEncoder::encode(const SL::Screen_Capture::Image& img)
+{
+    using namespace SL::Screen_Capture;
+    const int32_t codec = settings.requested_codec;
+    const bool tiled = settings.tiledFrames(codec);
+    if (tiled)
+        video_region.update(Width(img), Height(img), frame_dirty);
+    updateFrameRate();
+    updateCrop();
+
+    //refinement only frame still waiting in queue is outdated by new changes, its layers go again with them
+    if (tiled && !queued_refinements.empty() && isChanged(img))
+    {
+        if (out.purgeLastFrame())
+            refinements.swap(queued_refinements);
+        queued_refinements.clear();
+    }
+
+    //client is behind: picture is dropped instead of queued, the first one sent after is keyframe,
+    //so nothing changed meanwhile is missed
+    if (!out.frameSlotFree())
+    {
+        frame_dirty.clear();
+        resync = true;
+        return;
+    }
+    if (resync)
+        last_frame_w = 0;
+
+    //pending refinement layers and new head pose are sent even if picture did not change
+    bool has_frame = resync || isChanged(img) || (tiled && !refinements.empty()) || settings.pose().timestamp_ns != latched_pose_ns;
+    resync = false;
+    if (has_frame)
+    {
+        queued_refinements.clear();
+        FrameOut frame_new{elapsed(), 0, 0, 0, frame_packet, nullptr};
+        auto data_at = beginFramePacket();
+        if (tiled)
+        {
+            //top stripes go to client while the rest is encoded
+            if (settings.slice_count > 1)
+                frame_new.flush = [this, &frame_new, &data_at]()
+                {
+                    endFramePacket(frame_new, data_at, frame_codec::IMAGE_SLICE);
+                    out.sendFrame(frame_packet, !queued_refinements.empty(), &frame_lead);
+                    frame_lead.clear();
+                    data_at = beginFramePacket();
+                };
+            has_frame = ExtractAndEncodeTiles(img, frame_new, codec);
+            if (!has_frame)
+                queued_refinements.clear();
+        }
+        else
+            ExtractAndConvertToBGRA(img, frame_new, codec);
+        endFramePacket(frame_new, data_at, 0);
+    }
+    frame_dirty.clear();
+
+    if (has_frame)
+        out.sendFrame(frame_packet, !queued_refinements.empty(), &frame_lead);
+    else
+    {
+        //nothing to encode, old clients simply get nothing
+        if (settings.extraReplies())
+        {
+            frame_tick.timestamp_ns = elapsed();
+            out.send(frame_tick);
+        }
+    }
+    //layers keep coming while picture is still, grabber must not back off meanwhile
+    if (tiled && !refinements.empty())
+        wakeUp();
+}
+
+//starts reply::frame in frame_packet, returns position of its data field
+size_t FrameEncoder::beginFramePacket()
+{
+    namespace span = protocol::span;
+    frame_packet.clear();
+    span::Writer writer(frame_packet);
+    writer.header(span::messageId<reply::frame>(), 5);
+    return writer.beginBinary(span::label<&reply::frame::data>());
+}
+
+void FrameEncoder::endFramePacket(const FrameOut& frame, size_t data_at, int32_t extra_flags)
+{
+    namespace span = protocol::span;
+    span::Writer writer(frame_packet);
+    writer.endBinary(data_at);
+    writer.putInt(span::label<&reply::frame::timestamp_ns>(), frame.timestamp_ns);
+    writer.putInt(span::label<&reply::frame::flags>(), frame.flags | extra_flags);
+    writer.putInt(span::label<&reply::frame::w>(), frame.w);
+    writer.putInt(span::label<&reply::frame::h>(), frame.h);
+}
+
+//video playback needs higher rate
+void FrameEncoder::updateFrameRate()
+{
+    const auto interval = settings.frameInterval((video_region.region().empty()) ? FRAME_INTERVAL : VIDEO_FRAME_INTERVAL);
+    auto grabber = grabber_ptr.load();
+    if (interval != frame_interval && grabber)
+    {
+        frame_interval = interval;
+        grabber->setFrameChangeInterval(interval);
+    }
+}
+
+//while video plays grabber takes its region only, whole picture once per background interval,
+//so the rest of the screen is grabbed as rarely as it is sent
+void FrameEncoder::updateCrop()
+{
+    //frame_interval is set together with grabber
+    auto grabber = grabber_ptr.load();
+    if (!grabber)
+        return;
+    const auto video = video_region.region();
+    const int full_every = std::max<int>(1, BACKGROUND_INTERVAL / frame_interval);
+    if (video == grab_crop && full_every == grab_full_every)
+        return;
+    grab_crop = video;
+    grab_full_every = full_every;
+    grabber->setCropRegion(SL::Screen_Capture::Point{video.x, video.y}, SL::Screen_Capture::Point{video.w, video.h}, full_every);
+}
+
+//capture buffer bytes and bytes per line
+static const uint8_t* captureBytes(const SL::Screen_Capture::Image& img, size_t& stride)
+{
+    using namespace SL::Screen_Capture;
+    static_assert(sizeof(ImageBGRA) == 4, "Expecting 4 bytes/pixel!");
+    const auto start = StartSrc(img);
+    stride = ((isDataContiguous(img)) ? Width(img) : GotoNextRow(img, start) - start) * sizeof(ImageBGRA);
+    return reinterpret_cast<const uint8_t*>(start);
+}
+
+//frame is captured picture reduced if client's screen is much smaller, returns its size
+std::pair<int, int> FrameEncoder::frameSize(const SL::Screen_Capture::Image &img)
+{
+    using namespace SL::Screen_Capture;
+    const int w = Width(img);
+    const int h = Height(img);
+    const int scale = settings.requested_scale;
+    const int shrinkW = (scale > 0) ? scale : std::max<int>(1, w / std::max(1, settings.screen_width));
+    const int shrinkH = (scale > 0) ? scale : std::max<int>(1, h / std::max(1, settings.screen_height));
+    frame_shrink_w = shrinkW;
+    frame_shrink_h = shrinkH;
+    return {std::max(1, w / shrinkW), std::max(1, h / shrinkH)};
+}
+
+//late latching: viewport of the latest pose in picture w x h, taken right before encoding,
+//client is told where frame of timestamp_ns is cut from by reply queued with the frame; whole picture without pose
+frame_codec::Rect FrameEncoder::latchViewport(int w, int h, int64_t timestamp_ns)
+{
+    namespace span = protocol::span;
+    using Viewport = reply::viewport;
+    frame_lead.clear();
+    const auto p = settings.pose();
+    latched_pose_ns = p.timestamp_ns;
+    const frame_codec::Rect all{0, 0, w, h};
+    if (p.view_w <= 0 || p.view_h <= 0 || p.fov_x <= 0 || p.fov_y <= 0)
+    {
+        view_x = 0;
+        view_y = 0;
+        return all;
+    }
+    const int vw = std::min(w, p.view_w);
+    const int vh = std::min(h, p.view_h);
+    const int cx = w / 2 + static_cast<int>(static_cast<int64_t>(p.yaw) * w / p.fov_x);
+    const int cy = h / 2 - static_cast<int>(static_cast<int64_t>(p.pitch) * h / p.fov_y);
+    const frame_codec::Rect view{std::min(w - vw, std::max(0, cx - vw / 2)), std::min(h - vh, std::max(0, cy - vh / 2)), vw, vh};
+    view_x = view.x;
+    view_y = view.y;
+
+    span::Writer writer(frame_lead);
+    writer.header(span::messageId<Viewport>(), 4);
+    writer.putInt(span::label<&Viewport::timestamp_ns>(), timestamp_ns);
+    writer.putInt(span::label<&Viewport::pose_timestamp_ns>(), p.timestamp_ns);
+    writer.putInt(span::label<&Viewport::x>(), view.x);
+    writer.putInt(span::label<&Viewport::y>(), view.y);
+    return view;
+}
+
+//RGB888 of frame area r converted straight from capture buffer, reduced pixels average whole blocks
+void FrameEncoder::extractRGB(const SL::Screen_Capture::Image &img, const frame_codec::Rect& r, uint8_t* dst, size_t dst_stride) const
+{
+    size_t stride;
+    const auto src = captureBytes(img, stride);
+    const int sw = frame_shrink_w;
+    const int sh = frame_shrink_h;
+    pixel_format::shrinkBGRX8888<false>(src, stride, r.x * sw, r.y * sh, r.w * sw, r.h * sh, sw, sh, dst, dst_stride);
+}
+
+//BGRX tile of frame area r reduced by scale, capture pixels are copied as is when there is no reduction
+void FrameEncoder::appendBGRX(const SL::Screen_Capture::Image &img, const frame_codec::Rect& r, int scale,
+                              std::vector<uint8_t>& out) const
+{
+    size_t stride;
+    const auto src = captureBytes(img, stride);
+    const int sw = frame_shrink_w;
+    const int sh = frame_shrink_h;
+    const size_t line = static_cast<size_t>((r.w + scale - 1) / scale) * 4;
+    const size_t at = out.size();
+    out.resize(at + line * ((r.h + scale - 1) / scale));
+    pixel_format::shrinkBGRX8888<true>(src, stride, r.x * sw, r.y * sh, r.w * sw, r.h * sh, sw * scale, sh * scale,
+                                       out.data() + at, line);
+}
+
+//whole frame as single picture, PNG unless client asked for JPEG
+void FrameEncoder::ExtractAndConvertToBGRA(const SL::Screen_Capture::Image &img, FrameOut& dst, int32_t codec)
+{
+    using namespace frame_codec;
+    const auto size = frameSize(img);
+    const auto view = latchViewport(size.first, size.second, dst.timestamp_ns);
+    RgbVector rgb;
+    rgb.resize(static_cast<size_t>(view.w) * view.h * 3);
+    extractRGB(img, view, rgb.data(), static_cast<size_t>(view.w) * 3);
+
+    dst.w = view.w;
+    dst.h = view.h;
+    if (settings.stereo_layout && settings.clientTiles())
+    {
+        encodeStereo(rgb, dst, (codec == IMAGE_JPEG) ? IMAGE_JPEG : IMAGE_PNG);
+        return;
+    }
+    dst.flags = IMAGE_JPEG;
+    if (codec != IMAGE_JPEG || !appendJpeg(rgb.data(), dst.w, dst.h, settings.jpegQuality(IMAGE_JPEG_QUALITY), dst.data))
+    {
+        dst.flags = IMAGE_PNG;
+        appendPng(rgb, dst.w, dst.h, dst.data);
+    }
+}
+
+//side by side frame as 2 tiles, right eye is encoded by worker meanwhile or copied from the left one
+void FrameEncoder::encodeStereo(const RgbVector& rgb, FrameOut& dst, int32_t tile_codec)
+{
+    using namespace frame_codec;
+    const int half = dst.w / 2;
+    const Rect left{0, 0, half, dst.h};
+    const Rect right{half, 0, dst.w - half, dst.h};
+    const int quality = settings.jpegQuality(IMAGE_JPEG_QUALITY);
+    const int w = dst.w;
+    //returns codec used, PNG when JPEG failed
+    const auto encode = [&rgb, w, tile_codec, quality](const Rect & r, std::vector<uint8_t>& out)
+    {
+        ImageVector crop;
+        cropRGB(rgb, w, r, crop);
+        if (tile_codec == IMAGE_JPEG && appendJpeg(crop.data(), r.w, r.h, quality, out))
+            return IMAGE_JPEG;
+        appendPng(crop, r.w, r.h, out);
+        return IMAGE_PNG;
+    };
+
+    dst.flags = IMAGE_TILED;
+    TiledFrameWriter tiles(dst.data);
+    //mono content shown in VR
+    if (left.w == right.w && sameArea(rgb, w, right, left.x, left.y))
+    {
+        tiles.add(left, tile_codec, 1, [&](std::vector<uint8_t>& out)
+        {
+            return encode(left, out);
+        });
+        tiles.add(right, IMAGE_COPY, 1, [&](std::vector<uint8_t>& out)
+        {
+            appendCopySource(left.x, left.y, out);
+        });
+        return;
+    }
+
+    worker_tiles.clear();
+    int32_t right_codec = tile_codec;
+    std::future<void> right_done;
+    if (MULTICORE)
+        right_done = worker.push([&](int)
+        {
+            right_codec = encode(right, worker_tiles);
+        }, []()
+        {
+            return true;
+        });
+    tiles.add(left, tile_codec, 1, [&](std::vector<uint8_t>& out)
+    {
+        return encode(left, out);
+    });
+    if (right_done.valid())
+        right_done.get();
+    else
+        right_codec = encode(right, worker_tiles);
+    tiles.add(right, right_codec, 1, [&](std::vector<uint8_t>& out)
+    {
+        out.insert(out.end(), worker_tiles.begin(), worker_tiles.end());
+    });
+}
+
+//IMAGE_TILED frame: dirty rectangles only, video region as JPEG at high rate, rest of the screen rarely
+bool FrameEncoder::ExtractAndEncodeTiles(const SL::Screen_Capture::Image &img, FrameOut& dst, int32_t codec)
+{
+    using namespace frame_codec;
+    using pixel_format::RawFormat;
+    TiledPicture pic{img, frame_rgb};
+    pic.codec = codec;
+    pic.fixed_codec = codec == IMAGE_PNG || codec == IMAGE_QOI || codec == IMAGE_RAW;
+    pic.format = settings.raw_format;
+    pic.lossless = settings.lossless_codec;
+    pic.passthrough = codec == IMAGE_RAW && pic.format == RawFormat::BGRX8888;
+
+    const auto size = frameSize(img);
+    //cut as late as possible, so it follows head the best
+    pic.view = latchViewport(size.first, size.second, dst.timestamp_ns);
+    pic.w = pic.view.w;
+    pic.h = pic.view.h;
+    pic.preview = settings.preview_scale;
+    pic.periphery = settings.periphery_scale;
+    pic.eyes = settings.fovea_eyes;
+    pic.fovea = settings.fovea_percent;
+
+    dst.w = pic.w;
+    dst.h = pic.h;
+    TiledFrameWriter tiles(dst.data);
+    work.clear();
+
+    const auto& view = pic.view;
+    const int dx = view.x - last_view_x;
+    const int dy = view.y - last_view_y;
+    const Rect frame_rect{0, 0, pic.w, pic.h};
+    //part of the new frame client has already, shifted when viewport moved
+    const auto kept = (pic.w == last_frame_w && pic.h == last_frame_h) ? frame_rect.intersected(frame_rect.moved(-dx, -dy)) : Rect();
+    if (kept.empty())
+    {
+        //keyframe, client has nothing to apply deltas to
+        last_frame_w = pic.w;
+        last_frame_h = pic.h;
+        last_view_x = view.x;
+        last_view_y = view.y;
+        background_dirty.clear();
+        last_background = now();
+        xor_history.clear();
+        refinements.clear();
+        dst.flags = IMAGE_TILED;
+        //horizontal stripes, client decodes them in parallel
+        const int stripes = std::max(1, std::min<int>(settings.decoder_threads, pic.h / 64));
+        for (int i = 0; i < stripes; ++i)
+        {
+            const int top = pic.h * i / stripes;
+            work.push_back(WorkItem{Rect{0, top, pic.w, pic.h * (i + 1) / stripes - top}, Work::Classified, pic.preview});
+        }
+    }
+    else
+    {
+        dst.flags = IMAGE_TILED | IMAGE_DELTA;
+        if (dx || dy)
+            moveView(pic, kept, tiles);
+        collectChanges(pic);
+        //frame of refinement layers only may be purged from queue, they are restored then
+        const bool refine_only = std::all_of(work.begin(), work.end(), [](const WorkItem & item)
+        {
+            return item.kind == Work::Refine;
+        });
+        if (refine_only)
+            for (const auto& item : work)
+                queued_refinements.push_back(Refinement{item.rect, item.scale});
+    }
+
+    //only areas which are sent are converted, the rest of frame_rgb is what client has already
+    if (!pic.passthrough)
+    {
+        frame_rgb.resize(static_cast<size_t>(pic.w) * pic.h * 3);
+        const size_t line = static_cast<size_t>(pic.w) * 3;
+        for (const auto& item : work)
+            extractRGB(img, item.rect.moved(view.x, view.y), frame_rgb.data() + item.rect.y * line + item.rect.x * 3, line);
+    }
+    return encodeWork(pic, dst, tiles);
+}
+
+//viewport moved by less than its size: client shifts what it has by copy tile, pending areas are shifted the same way
+//and only uncovered edges are encoded; frame_rgb is read in areas being sent only, so it is not shifted
+void FrameEncoder::moveView(const TiledPicture& pic, const frame_codec::Rect& kept, frame_codec::TiledFrameWriter& tiles)
+{
+    using namespace frame_codec;
+    const int dx = pic.view.x - last_view_x;
+    const int dy = pic.view.y - last_view_y;
+    const Rect frame_rect{0, 0, pic.w, pic.h};
+    last_view_x = pic.view.x;
+    last_view_y = pic.view.y;
+
+    tiles.add(kept, IMAGE_COPY, 1, [&](std::vector<uint8_t>& out)
+    {
+        appendCopySource(kept.x + dx, kept.y + dy, out);
+    });
+    const auto shift = [&](Rect& r)
+    {
+        r = r.moved(-dx, -dy).intersected(frame_rect);
+        return r.empty();
+    };
+    refinements.erase(std::remove_if(refinements.begin(), refinements.end(), [&shift](Refinement & r)
+    {
+        return shift(r.rect);
+    }), refinements.end());
+    background_dirty.erase(std::remove_if(background_dirty.begin(), background_dirty.end(), shift), background_dirty.end());
+    //client keeps references by rect, moved video region starts with QOI again
+    xor_history.clear();
+
+    forEachOutside(frame_rect, kept, [&](const Rect & r)
+    {
+        work.push_back(WorkItem{r, Work::Classified, pic.preview});
+    });
+}
+
+//delta frame work: background accumulated while video plays, next refinement layers, video region
+void FrameEncoder::collectChanges(const TiledPicture& pic)
+{
+    using namespace frame_codec;
+    const auto tm = now();
+    const Rect frame_rect{0, 0, pic.w, pic.h};
+    const int sw = frame_shrink_w;
+    const int sh = frame_shrink_h;
+    const auto& view = pic.view;
+    const auto video = video_region.region().shrinked(sw, sh).moved(-view.x, -view.y).intersected(frame_rect);
+    const auto add_background = [this](const Rect & r)
+    {
+        for (const auto& b : background_dirty)
+            if (b.contains(r))
+                return;
+        background_dirty.push_back(r);
+    };
+
+    bool video_dirty = false;
+    for (const auto& r : frame_dirty)
+    {
+        const auto fr = r.shrinked(sw, sh).moved(-view.x, -view.y).intersected(frame_rect);
+        if (fr.empty())
+            continue;
+        if (!video.intersected(fr).empty())
+            video_dirty = true;
+        if (!video.contains(fr))
+            add_background(fr);
+    }
+
+    //while video plays the rest of the screen is sent rarely, it is accumulated meanwhile
+    if (!background_dirty.empty() && (video.empty() || tm - last_background >= BACKGROUND_INTERVAL))
+    {
+        if (background_dirty.size() > MAX_BACKGROUND_TILES)
+        {
+            Rect all;
+            for (const auto& r : background_dirty)
+                all = all.united(r);
+            background_dirty = {all};
+        }
+        for (const auto& r : background_dirty)
+            work.push_back(WorkItem{r, Work::Classified, pic.preview});
+        background_dirty.clear();
+        last_background = tm;
+    }
+
+    //next layers of previously sent previews, parts changed again restart from preview instead
+    std::vector<Refinement> pending;
+    pending.swap(refinements);
+    std::vector<Rect> parts;
+    std::vector<Rect> left;
+    const auto cut = [&parts, &left](const Rect & hole)
+    {
+        left.clear();
+        for (const auto& r : parts)
+            forEachOutside(r, hole, [&left](const Rect & o)
+            {
+                left.push_back(o);
+            });
+        parts.swap(left);
+    };
+    for (const auto& p : pending)
+    {
+        parts.assign(1, p.rect);
+        for (const auto& item : work)
+            cut(item.rect);
+        if (video_dirty)
+            cut(video);
+        for (const auto& r : parts)
+            work.insert(work.begin(), WorkItem{r, Work::Refine, p.scale});
+    }
+
+    //video goes last, so it is on top of background tiles which may overlap it
+    if (video_dirty)
+        work.push_back(WorkItem{video, (pic.codec == IMAGE_XOR) ? Work::VideoXor : Work::Video, 1});
+}
+
+//side by side: work is cut by eyes, right pieces equal to left ones sent in this frame become copies
+void FrameEncoder::splitStereo(const TiledPicture& pic)
+{
+    using namespace frame_codec;
+    const int half = pic.w / 2;
+    std::vector<WorkItem> split;
+    for (const auto& item : work)
+    {
+        if (item.kind == Work::VideoXor)
+        {
+            split.push_back(item);
+            continue;
+        }
+        for (const auto& eye : {Rect{0, 0, half, pic.h}, Rect{half, 0, half, pic.h}})
+        {
+            const auto r = item.rect.intersected(eye);
+            if (!r.empty())
+                split.push_back(WorkItem{r, item.kind, item.scale});
+        }
+    }
+    for (auto& item : split)
+    {
+        if (item.kind == Work::VideoXor || item.rect.x < half)
+            continue;
+        const Rect mirror{item.rect.x - half, item.rect.y, item.rect.w, item.rect.h};
+        const bool sent = std::any_of(split.begin(), split.end(), [&mirror](const WorkItem & o)
+        {
+            return o.kind != Work::VideoXor && o.kind != Work::Copy && o.rect.contains(mirror);
+        });
+        if (sent && sameArea(pic.rgb, pic.w, item.rect, mirror.x, mirror.y))
+            item.kind = Work::Copy;
+    }
+    work.swap(split);
+}
+
+//encodes collected work, in slice mode stripe by stripe with flush after each;
+//big slice work is cut at the middle and the right pieces are encoded by worker meanwhile,
+//halves never overlap, so their tiles may go one after another
+bool FrameEncoder::encodeWork(const TiledPicture& pic, FrameOut& dst, frame_codec::TiledFrameWriter& tiles)
+{
+    using namespace frame_codec;
+    const int w = pic.w;
+    const int h = pic.h;
+    if (settings.stereo_layout && w % 2 == 0 && !pic.passthrough)
+        splitStereo(pic);
+    const int slices = (dst.flush) ? std::max(1, std::min(settings.slice_count.load(), h / 16)) : 1;
+    const Rect left_half{0, 0, w / 2, h};
+    const Rect right_half{w / 2, 0, w - w / 2, h};
+    std::vector<WorkItem> pieces;
+    std::vector<WorkItem> left_pieces;
+    std::vector<WorkItem> right_pieces;
+    size_t flushed = 0;
+    for (int i = 0; i < slices; ++i)
+    {
+        const int top = h * i / slices;
+        const Rect slice{0, top, w, h * (i + 1) / slices - top};
+        const bool last = i + 1 == slices;
+        pieces.clear();
+        int64_t pixels = 0;
+        for (const auto& item : work)
+        {
+            if (item.kind == Work::VideoXor || item.kind == Work::Copy)
+                continue;
+            const auto r = item.rect.intersected(slice);
+            if (r.empty())
+                continue;
+            pieces.push_back(WorkItem{r, item.kind, item.scale});
+            pixels += static_cast<int64_t>(r.w) * r.h;
+            if (item.kind != Work::Video && item.scale > 1)
+                refinements.push_back(Refinement{r, item.scale / 2});
+        }
+
+        if (!MULTICORE || pixels < PARALLEL_MIN_PIXELS || w < 2)
+            encodePieces(pic, pieces, tiles, tile_rgb);
+        else
+        {
+            left_pieces.clear();
+            right_pieces.clear();
+            for (const auto& p : pieces)
+            {
+                const auto l = p.rect.intersected(left_half);
+                const auto r = p.rect.intersected(right_half);
+                if (!l.empty())
+                    left_pieces.push_back(WorkItem{l, p.kind, p.scale});
+                if (!r.empty())
+                    right_pieces.push_back(WorkItem{r, p.kind, p.scale});
+            }
+            worker_tiles.clear();
+            TiledFrameWriter right_tiles(worker_tiles);
+            auto right_done = worker.push([&](int)
+            {
+                encodePieces(pic, right_pieces, right_tiles, worker_rgb);
+            }, []()
+            {
+                return true;
+            });
+            encodePieces(pic, left_pieces, tiles, tile_rgb);
+            right_done.get();
+            tiles.append(right_tiles);
+        }
+
+        //XOR tile must cover the same rect as its reference, so it is never cut
+        for (const auto& item : work)
+            if (last && item.kind == Work::VideoXor)
+                addVideoXor(tiles, pic.rgb, w, item.rect, dst.timestamp_ns);
+        //after all tiles, so sources are drawn already
+        for (const auto& item : work)
+        {
+            if (!last || item.kind != Work::Copy)
+                continue;
+            tiles.add(item.rect, IMAGE_COPY, 1, [&](std::vector<uint8_t>& out)
+            {
+                appendCopySource(item.rect.x - w / 2, item.rect.y, out);
+            });
+            if (item.scale > 1)
+                refinements.push_back(Refinement{item.rect, item.scale / 2});
+        }
+        if (!last && tiles.count() > flushed)
+        {
+            flushed = tiles.count();
+            dst.flush();
+            //next slices update picture sent already
+            dst.flags |= IMAGE_DELTA;
+        }
+    }
+    return tiles.count() > 0;
+}
+
+//tiles of pieces in their order, called by frame thread and worker with own scratch buffers
+void FrameEncoder::encodePieces(const TiledPicture& pic, const std::vector<WorkItem>& pieces,
+                                frame_codec::TiledFrameWriter& tiles, RgbVector& scratch) const
+{
+    using namespace frame_codec;
+    for (const auto& item : pieces)
+    {
+        if (item.kind == Work::Video)
+            foveate(pic, item.rect, 1, [&](const Rect & p, int scale, bool outside)
+            {
+                addTile(pic, tiles, p, IMAGE_JPEG, (outside) ? PERIPHERY_JPEG_QUALITY : VIDEO_JPEG_QUALITY, scale, scratch);
+            });
+        else
+            foveate(pic, item.rect, item.scale, [&](const Rect & p, int scale, bool outside)
+            {
+                //periphery did not get sharper since previous layer
+                if (outside && item.kind == Work::Refine && item.scale * 2 <= pic.periphery)
+                    return;
+                addClassified(pic, tiles, p, scale, (outside) ? PERIPHERY_JPEG_QUALITY : IMAGE_JPEG_QUALITY, scratch);
+            });
+    }
+}
+
+void FrameEncoder::addTile(const TiledPicture& pic, frame_codec::TiledFrameWriter& tiles, const frame_codec::Rect& r,
+                           int32_t tile_codec, int quality, int scale, RgbVector& scratch) const
+{
+    using namespace frame_codec;
+    if (pic.fixed_codec)
+        tile_codec = pic.codec;
+    else if (tile_codec == IMAGE_PNG)
+        tile_codec = pic.lossless;
+    if (pic.passthrough)
+    {
+        tiles.add(r, tile_codec, scale, [&](std::vector<uint8_t>& out)
+        {
+            appendBGRX(pic.img, r.moved(pic.view.x, pic.view.y), scale, out);
+        });
+        return;
+    }
+    if (scale > 1)
+        pixel_format::shrinkRGB888(pic.rgb.data() + (static_cast<size_t>(r.y) * pic.w + r.x) * 3, pic.w, r.w, r.h, scale, scratch);
+    else
+        cropRGB(pic.rgb, pic.w, r, scratch);
+    const int cw = (r.w + scale - 1) / scale;
+    const int ch = (r.h + scale - 1) / scale;
+    tiles.add(r, tile_codec, scale, [&](std::vector<uint8_t>& out)
+    {
+        if (tile_codec == IMAGE_JPEG && appendJpeg(scratch.data(), cw, ch, settings.jpegQuality(quality), out))
+            return IMAGE_JPEG;
+        //tile JPEG failed to encode goes lossless
+        const int32_t used = (tile_codec == IMAGE_JPEG) ? pic.lossless : tile_codec;
+        if (used == IMAGE_QOI)
+            appendQoi(scratch, cw, ch, out);
+        else if (used == IMAGE_RAW)
+            pixel_format::appendConverted(pic.format, scratch.data(), cw, ch, out);
+        else
+            appendPng(scratch, cw, ch, out);
+        return used;
+    });
+}
+
+//text and UI stay lossless, pictures inside of the area go lossy
+void FrameEncoder::addClassified(const TiledPicture& pic, frame_codec::TiledFrameWriter& tiles, const frame_codec::Rect& r,
+                                 int scale, int quality, RgbVector& scratch) const
+{
+    using namespace frame_codec;
+    if (pic.fixed_codec)
+        addTile(pic, tiles, r, pic.codec, quality, scale, scratch);
+    else
+        splitByContent(pic.rgb, pic.w, r, [&](const Rect& t, int32_t tile_codec)
+        {
+            addTile(pic, tiles, t, tile_codec, quality, scale, scratch);
+        });
+}
+
+//splits r into full resolution eye centers and reduced periphery
+template <class Callback>
+void FrameEncoder::foveate(const TiledPicture& pic, const frame_codec::Rect& r, int scale, const Callback& callback) const
+{
+    using namespace frame_codec;
+    if (pic.periphery <= 1)
+    {
+        callback(r, scale, false);
+        return;
+    }
+    const int w = pic.w;
+    const int eyes = pic.eyes;
+    const int fovea = pic.fovea;
+    for (int e = 0; e < eyes; ++e)
+    {
+        const Rect eye{w * e / eyes, 0, w * (e + 1) / eyes - w * e / eyes, pic.h};
+        const auto part = r.intersected(eye);
+        if (part.empty())
+            continue;
+        const Rect center{eye.x + eye.w * (100 - fovea) / 200, eye.h * (100 - fovea) / 200,
+                          eye.w * fovea / 100, eye.h * fovea / 100};
+        const auto inner = part.intersected(center);
+        if (!inner.empty())
+            callback(inner, scale, false);
+        forEachOutside(part, center, [&](const Rect & p)
+        {
+            callback(p, std::max(scale, pic.periphery), true);
+        });
+    }
+}
+
+//latest video tile client has acknowledged, it must cover the same rect
+const FrameEncoder::XorReference* FrameEncoder::findXorReference(const frame_codec::Rect& rect)
+{
+    const int64_t acked = settings.acked_frame;
+    auto it = std::find_if(xor_history.rbegin(), xor_history.rend(), [acked](const XorReference & r)
+    {
+        return r.timestamp_ns <= acked;
+    });
+    if (it == xor_history.rend())
+        return nullptr;
+    //older ones will not be referenced anymore, acks come in order
+    xor_history.erase(xor_history.begin(), std::prev(it.base()));
+    const auto& ref = xor_history.front();
+    return (ref.rect == rect) ? &ref : nullptr;
+}
+
+//lossless video tile: XOR against acknowledged reference or QOI keyframe when there is none
+void FrameEncoder::addVideoXor(frame_codec::TiledFrameWriter& tiles, const RgbVector& rgb, int w, const frame_codec::Rect& video,
+                               int64_t timestamp_ns)
+{
+    using namespace frame_codec;
+    XorReference current{timestamp_ns, video, RgbVector()};
+    cropRGB(rgb, w, video, current.rgb);
+
+    const auto ref = findXorReference(video);
+    tiles.add(video, (ref) ? IMAGE_XOR : IMAGE_QOI, 1, [&](std::vector<uint8_t>& out)
+    {
+        if (ref)
+            appendXorDelta(current.rgb, ref->rgb, ref->timestamp_ns, out);
+        else
+            appendQoi(current.rgb, video.w, video.h, out);
+    });
+
+    xor_history.push_back(std::move(current));
+    if (xor_history.size() > XOR_HISTORY)
+        xor_history.pop_front();
+}
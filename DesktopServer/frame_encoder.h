@@ -0,0 +1,189 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <vector>
+#include "ScreenCapture.h"
+#include "broadcast.h"
+#include "cm_ctors.h"
+#include "ctpl_stl.h"
+#include "pooled_shared.h"
+#include "frame_codec.h"
+#include "video_region.h"
+#include "encoder_settings.h"
+#include "reply_out.h"
+
+//Turns captured pictures into reply::frame packets as client's settings say: whole pictures for old clients,
+//IMAGE_TILED frames of changed areas otherwise, with video region, progressive layers, foveation,
+//stereo and viewport on top. All calls except toFramePixels() come from frame thread of the grabber.
+class FrameEncoder
+{
+public:
+    using RgbVector = pools::PooledVector<uint8_t>;
+
+    FrameEncoder() = delete;
+    NO_COPYMOVE(FrameEncoder);
+    FrameEncoder(const EncoderSettings& settings, ReplyOut& out);
+
+    //encoder sets frame rate of the grabber, it is alive while its threads call encoder
+    void setGrabber(SL::Screen_Capture::IScreenCaptureManager* grabber);
+
+    //frame queue has room after pictures were dropped, grabber must not wait in idle backoff
+    void wakeUp();
+
+    //frame timestamps count from here
+    void restartClock();
+
+    //called for each changed area before encode() of the same frame
+    void changed(const SL::Screen_Capture::Image& img);
+
+    //sends frame, tick or nothing for the whole captured picture
+    void encode(const SL::Screen_Capture::Image& img);
+
+    //capture position in pixels of the last frame sent, cursor must match them
+    std::pair<int, int> toFramePixels(int x, int y) const
+    {
+        return {x / frame_shrink_w - view_x, y / frame_shrink_h - view_y};
+    }
+
+private:
+    //reply::frame fields, data is encoded straight into the packet
+    struct FrameOut
+    {
+        int64_t timestamp_ns{0};
+        int32_t flags{0};
+        int32_t w{0};
+        int32_t h{0};
+        std::vector<uint8_t>& data;
+        //slice mode: sends tiles encoded so far as IMAGE_SLICE frame, data is empty after
+        std::function<void()> flush;
+    };
+
+    //IMAGE_TILED frame being encoded
+    struct TiledPicture
+    {
+        const SL::Screen_Capture::Image& img;
+        //frame_rgb, work areas are converted into it before encoding
+        RgbVector& rgb;
+        int w{0};
+        int h{0};
+        frame_codec::Rect view;
+        int32_t codec{0};
+        //codec IMAGE_PNG, IMAGE_QOI or IMAGE_RAW makes all tiles use it
+        bool fixed_codec{false};
+        pixel_format::RawFormat format{pixel_format::RawFormat::RGB888};
+        int32_t lossless{0};
+        //tiles are taken from capture buffer as BGRX, no conversion to RGB at all
+        bool passthrough{false};
+        //progressive preview and foveation
+        int preview{1};
+        int periphery{1};
+        int eyes{1};
+        int fovea{100};
+    };
+
+    //rectangles are collected first, in slice mode they are encoded stripe by stripe
+    enum class Work {Classified, Refine, Video, VideoXor, Copy};
+    struct WorkItem
+    {
+        frame_codec::Rect rect;
+        Work kind;
+        int scale;
+    };
+
+    //video tiles sent losslessly, client refers to them by frame timestamp
+    struct XorReference
+    {
+        int64_t timestamp_ns;
+        frame_codec::Rect rect;
+        RgbVector rgb;
+    };
+
+    //progressive mode: area sent reduced, next frame sends it with that scale
+    struct Refinement
+    {
+        frame_codec::Rect rect;
+        int scale;
+    };
+
+    const EncoderSettings& settings;
+    ReplyOut& out;
+    std::chrono::steady_clock::time_point started_at;
+    std::atomic<SL::Screen_Capture::IScreenCaptureManager*> grabber_ptr{nullptr};
+    std::chrono::milliseconds frame_interval{0};
+    //region grabber crops frames to and how often it grabs whole picture
+    frame_codec::Rect grab_crop;
+    int grab_full_every{0};
+
+    protocol::broadcast::reply::tick frame_tick;
+    //whole marshaled reply::frame, capacity is reused by next frames
+    std::vector<uint8_t> frame_packet;
+    std::vector<frame_codec::Rect> frame_dirty;
+    VideoRegionDetector video_region;
+    int last_frame_w{0};
+    int last_frame_h{0};
+    int last_view_x{0};
+    int last_view_y{0};
+    //pictures were dropped while frame queue was full, next frame must be keyframe
+    bool resync{false};
+    std::vector<frame_codec::Rect> background_dirty;
+    std::chrono::steady_clock::time_point last_background;
+    std::deque<XorReference> xor_history;
+    std::vector<Refinement> refinements;
+    //layers carried by refinement only frame which is the last one queued, sent again if it is purged
+    std::vector<Refinement> queued_refinements;
+    std::vector<WorkItem> work;
+    //tile pixels before encoding, worker has its own
+    RgbVector tile_rgb;
+    RgbVector worker_rgb;
+    //tiles encoded by worker, appended after the ones of frame thread
+    std::vector<uint8_t> worker_tiles;
+    //RGB888 of the tiled frame, work areas are converted into it from capture and only they are read
+    RgbVector frame_rgb;
+    //marshaled reply::viewport of frame being encoded, queued with its first packet
+    std::vector<uint8_t> frame_lead;
+    //pose the last viewport was latched for, newer one moves viewport over still picture too
+    int64_t latched_pose_ns{0};
+
+    //last frame downscale and where it was cut from, read by cursor thread
+    std::atomic<int> frame_shrink_w{1};
+    std::atomic<int> frame_shrink_h{1};
+    std::atomic<int> view_x{0};
+    std::atomic<int> view_y{0};
+
+    //second core: right half of big tiled work, right eye of whole stereo frame
+    ctpl::thread_pool worker{1};
+
+    int64_t elapsed() const;
+    size_t beginFramePacket();
+    void endFramePacket(const FrameOut& frame, size_t data_at, int32_t extra_flags);
+    void updateFrameRate();
+    void updateCrop();
+
+    std::pair<int, int> frameSize(const SL::Screen_Capture::Image& img);
+    frame_codec::Rect latchViewport(int w, int h, int64_t timestamp_ns);
+    void extractRGB(const SL::Screen_Capture::Image& img, const frame_codec::Rect& r, uint8_t* dst, size_t dst_stride) const;
+    void appendBGRX(const SL::Screen_Capture::Image& img, const frame_codec::Rect& r, int scale, std::vector<uint8_t>& out) const;
+
+    void ExtractAndConvertToBGRA(const SL::Screen_Capture::Image& img, FrameOut& dst, int32_t codec);
+    void encodeStereo(const RgbVector& rgb, FrameOut& dst, int32_t tile_codec);
+
+    bool ExtractAndEncodeTiles(const SL::Screen_Capture::Image& img, FrameOut& dst, int32_t codec);
+    void moveView(const TiledPicture& pic, const frame_codec::Rect& kept, frame_codec::TiledFrameWriter& tiles);
+    void collectChanges(const TiledPicture& pic);
+    void splitStereo(const TiledPicture& pic);
+    bool encodeWork(const TiledPicture& pic, FrameOut& dst, frame_codec::TiledFrameWriter& tiles);
+    void encodePieces(const TiledPicture& pic, const std::vector<WorkItem>& pieces, frame_codec::TiledFrameWriter& tiles,
+                      RgbVector& scratch) const;
+    void addTile(const TiledPicture& pic, frame_codec::TiledFrameWriter& tiles, const frame_codec::Rect& r,
+                 int32_t tile_codec, int quality, int scale, RgbVector& scratch) const;
+    void addClassified(const TiledPicture& pic, frame_codec::TiledFrameWriter& tiles, const frame_codec::Rect& r,
+                       int scale, int quality, RgbVector& scratch) const;
+    template <class Callback>
+    void foveate(const TiledPicture& pic, const frame_codec::Rect& r, int scale, const Callback& callback) const;
+
+    const XorReference* findXorReference(const frame_codec::Rect& rect);
+    void addVideoXor(frame_codec::TiledFrameWriter& tiles, const RgbVector& rgb, int w, const frame_codec::Rect& video,
+                     int64_t timestamp_ns);
+};
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <csetjmp>
+#include <vector>
+#include <algorithm>
+#include <jpeglib.h>
+#include "cm_ctors.h"
+
+/*
+ * Baseline JPEG encoder on top of libjpeg(-turbo): YCbCr 4:2:0, fast integer DCT, standard Huffman tables.
+ * Compressor is created once and reused by all pictures, result is written straight into std::vector.
+ * Quality is 1..100. Object is used by one thread at a time.
+ */
+class JpegOut final
+{
+public:
+    NO_COPYMOVE(JpegOut);
+    NO_NEW;
+
+    JpegOut()
+    {
+        cinfo.err = jpeg_std_error(&error.mgr);
+        error.mgr.error_exit = &JpegOut::onError;
+        error.mgr.output_message = [](j_common_ptr) {};
+        jpeg_create_compress(&cinfo);
+
+        dest.init_destination = &JpegOut::initDestination;
+        dest.empty_output_buffer = &JpegOut::emptyOutputBuffer;
+        dest.term_destination = &JpegOut::termDestination;
+        cinfo.dest = &dest;
+        cinfo.client_data = this;
+    }
+
+    ~JpegOut()
+    {
+        jpeg_destroy_compress(&cinfo);
+    }
+
+    //encodes RGB888 picture which has stride bytes per line, result is appended to dst;
+    //false means libjpeg failed, dst is left as it was then
+    bool encode(const uint8_t* rgb, int w, int h, size_t stride, int quality, std::vector<uint8_t>& dst)
+    {
+        return compress(rgb, w, h, stride, quality, JCS_RGB, 3, dst);
+    }
+
+private:
+    struct ErrorManager
+    {
+        jpeg_error_mgr mgr;
+        std::jmp_buf jump;
+    };
+
+    jpeg_compress_struct cinfo{};
+    ErrorManager error{};
+    jpeg_destination_mgr dest{};
+    std::vector<uint8_t>* out{nullptr};
+    size_t out_start{0};
+
+    //output grows by this much when libjpeg fills it
+    constexpr static size_t OUTPUT_STEP = 64 * 1024;
+
+    bool compress(const uint8_t* pixels, int w, int h, size_t stride, int quality, J_COLOR_SPACE space, int components,
+                  std::vector<uint8_t>& dst)
+    {
+        if (w < 1 || h < 1)
+            return false;
+        out = &dst;
+        out_start = dst.size();
+        if (setjmp(error.jump))
+        {
+            jpeg_abort_compress(&cinfo);
+            dst.resize(out_start);
+            return false;
+        }
+
+        cinfo.image_width = static_cast<JDIMENSION>(w);
+        cinfo.image_height = static_cast<JDIMENSION>(h);
+        cinfo.input_components = components;
+        cinfo.in_color_space = space;
+        jpeg_set_defaults(&cinfo);
+        jpeg_set_quality(&cinfo, std::min(100, std::max(1, quality)), TRUE);
+        cinfo.dct_method = JDCT_IFAST;
+        jpeg_start_compress(&cinfo, TRUE);
+
+        JSAMPROW rows[16];
+        while (cinfo.next_scanline < cinfo.image_height)
+        {
+            const auto n = std::min<JDIMENSION>(16, cinfo.image_height - cinfo.next_scanline);
+            for (JDIMENSION i = 0; i < n; ++i)
+                rows[i] = const_cast<JSAMPROW>(pixels + (cinfo.next_scanline + i) * stride);
+            jpeg_write_scanlines(&cinfo, rows, n);
+        }
+        jpeg_finish_compress(&cinfo);
+        return true;
+    }
+
+    static JpegOut& self(j_compress_ptr c)
+    {
+        return *static_cast<JpegOut*>(c->client_data);
+    }
+
+    static void onError(j_common_ptr c)
+    {
+        std::longjmp(reinterpret_cast<ErrorManager*>(c->err)->jump, 1);
+    }
+
+    static void initDestination(j_compress_ptr c)
+    {
+        auto& me = self(c);
+        me.out->resize(me.out_start + OUTPUT_STEP);
+        me.dest.next_output_byte = me.out->data() + me.out_start;
+        me.dest.free_in_buffer = OUTPUT_STEP;
+    }
+
+    //called when whole buffer is full
+    static boolean emptyOutputBuffer(j_compress_ptr c)
+    {
+        auto& me = self(c);
+        const auto used = me.out->size();
+        me.out->resize(used + OUTPUT_STEP);
+        me.dest.next_output_byte = me.out->data() + used;
+        me.dest.free_in_buffer = OUTPUT_STEP;
+        return TRUE;
+    }
+
+    static void termDestination(j_compress_ptr c)
+    {
+        auto& me = self(c);
+        me.out->resize(me.out->size() - me.dest.free_in_buffer);
+    }
+};
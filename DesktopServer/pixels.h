@@ -6,6 +6,11 @@
 #include "offset_iter.h"
 #include "marray.h"
 #include <type_traits>
+#include <vector>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 namespace pixel_format
 {
@@ -263,4 +268,342 @@ namespace pixel_format
         std::advance(out, pixels_amount);
         return out;
     }
+
+    //box filter reduction of RGB888 area w x h (source has src_w pixels per line) by scale times,
+    //result is (w + scale - 1) / scale x (h + scale - 1) / scale, edge boxes average pixels they have
+    template <class Dst>
+    void shrinkRGB888(const uint8_t* src, size_t src_w, size_t w, size_t h, size_t scale, Dst& dst)
+    {
+        const size_t nw = (w + scale - 1) / scale;
+        const size_t nh = (h + scale - 1) / scale;
+        dst.resize(nw * nh * 3);
+        uint8_t* out = dst.data();
+        for (size_t j = 0; j < h; j += scale)
+            for (size_t i = 0; i < w; i += scale, out += 3)
+            {
+                PixelAvr<uint8_t, 3> avr;
+                for (size_t y = j, ye = std::min(h, j + scale); y < ye; ++y)
+                    for (size_t x = i, xe = std::min(w, i + scale); x < xe; ++x)
+                        avr.add(src + (y * src_w + x) * 3);
+                avr.setAvr(out);
+            }
+    }
+
+    //area w x h at x, y of BGRX8888 picture which has src_stride bytes per line, reduced by box filter of bx x by
+    //pixels, edge boxes average pixels they have; result is (w + bx - 1) / bx x (h + by - 1) / by pixels
+    //in lines of dst_stride bytes, RGB888 or BGRX8888 as Bgrx says
+    template <bool Bgrx>
+    void shrinkBGRX8888(const uint8_t* src, size_t src_stride, size_t x, size_t y, size_t w, size_t h, size_t bx, size_t by,
+                        uint8_t* dst, size_t dst_stride)
+    {
+        constexpr size_t OUT = (Bgrx) ? 4 : 3;
+        const uint8_t* area = src + y * src_stride + x * 4;
+        if (bx == 1 && by == 1)
+        {
+            for (size_t j = 0; j < h; ++j, area += src_stride, dst += dst_stride)
+            {
+                if (Bgrx)
+                {
+                    std::copy_n(area, w * 4, dst);
+                    continue;
+                }
+                for (size_t i = 0; i < w; ++i)
+                {
+                    dst[i * 3 + 0] = area[i * 4 + 2];
+                    dst[i * 3 + 1] = area[i * 4 + 1];
+                    dst[i * 3 + 2] = area[i * 4 + 0];
+                }
+            }
+            return;
+        }
+        for (size_t j = 0; j < h; j += by, dst += dst_stride)
+        {
+            const size_t ye = std::min(h, j + by);
+            uint8_t* out = dst;
+            for (size_t i = 0; i < w; i += bx, out += OUT)
+            {
+                const size_t xe = std::min(w, i + bx);
+                uint32_t sum[3] = {0, 0, 0};
+                for (size_t yy = j; yy < ye; ++yy)
+                {
+                    const uint8_t* p = area + yy * src_stride + i * 4;
+                    for (size_t xx = i; xx < xe; ++xx, p += 4)
+                    {
+                        sum[0] += p[0];
+                        sum[1] += p[1];
+                        sum[2] += p[2];
+                    }
+                }
+                const auto n = static_cast<uint32_t>((ye - j) * (xe - i));
+                if (Bgrx)
+                {
+                    out[0] = static_cast<uint8_t>(sum[0] / n);
+                    out[1] = static_cast<uint8_t>(sum[1] / n);
+                    out[2] = static_cast<uint8_t>(sum[2] / n);
+                    out[3] = 0xFF;
+                }
+                else
+                {
+                    out[0] = static_cast<uint8_t>(sum[2] / n);
+                    out[1] = static_cast<uint8_t>(sum[1] / n);
+                    out[2] = static_cast<uint8_t>(sum[0] / n);
+                }
+            }
+        }
+    }
+
+    //reduced precision formats, raw sizes are 2/3, 1/3 and 1/2 of RGB888
+    enum class RawFormat : int32_t
+    {
+        RGB888 = 0,
+        RGB565 = 1, //little endian uint16, r in high bits
+        GRAY8  = 2,
+        YUV420 = 3, //planar Y, U, V (JFIF full range), chroma is (w + 1) / 2 x (h + 1) / 2
+        BGRX8888 = 4, //capture layout, X is garbage; taken from capture buffer, never converted from RGB888
+    };
+
+#ifdef __SSE2__
+    //loads 16 RGB888 pixels as 4 float vectors per channel
+    inline void loadRGB16(const uint8_t* src, __m128 (&r)[4], __m128 (&g)[4], __m128 (&b)[4])
+    {
+        const __m128i zero = _mm_setzero_si128();
+        __m128 f[12];
+        for (int i = 0; i < 3; ++i)
+        {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 16));
+            const __m128i lo = _mm_unpacklo_epi8(v, zero);
+            const __m128i hi = _mm_unpackhi_epi8(v, zero);
+            f[i * 4 + 0] = _mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero));
+            f[i * 4 + 1] = _mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero));
+            f[i * 4 + 2] = _mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero));
+            f[i * 4 + 3] = _mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero));
+        }
+        for (int k = 0; k < 4; ++k)
+        {
+            //a = r0 g0 b0 r1, b = g1 b1 r2 g2, c = b2 r3 g3 b3
+            const __m128 a = f[k * 3];
+            const __m128 bb = f[k * 3 + 1];
+            const __m128 c = f[k * 3 + 2];
+            r[k] = _mm_shuffle_ps(a, _mm_shuffle_ps(bb, c, _MM_SHUFFLE(0, 1, 0, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+            g[k] = _mm_shuffle_ps(_mm_shuffle_ps(a, bb, _MM_SHUFFLE(0, 0, 0, 1)),
+                                  _mm_shuffle_ps(bb, c, _MM_SHUFFLE(0, 2, 0, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+            b[k] = _mm_shuffle_ps(_mm_shuffle_ps(a, bb, _MM_SHUFFLE(0, 1, 0, 2)), c, _MM_SHUFFLE(3, 0, 2, 0));
+        }
+    }
+
+    //weighted sum of channels rounded to 16 bytes
+    inline __m128i weightedBytes16(const __m128 (&r)[4], const __m128 (&g)[4], const __m128 (&b)[4],
+                                   float wr, float wg, float wb, float offset)
+    {
+        __m128i v[4];
+        for (int k = 0; k < 4; ++k)
+        {
+            const __m128 sum = _mm_add_ps(_mm_add_ps(_mm_mul_ps(r[k], _mm_set1_ps(wr)), _mm_mul_ps(g[k], _mm_set1_ps(wg))),
+                                          _mm_add_ps(_mm_mul_ps(b[k], _mm_set1_ps(wb)), _mm_set1_ps(offset)));
+            v[k] = _mm_cvtps_epi32(sum);
+        }
+        return _mm_packus_epi16(_mm_packs_epi32(v[0], v[1]), _mm_packs_epi32(v[2], v[3]));
+    }
+#endif
+
+    inline uint8_t clampByte(float v)
+    {
+        return static_cast<uint8_t>(std::min(255.f, std::max(0.f, v + 0.5f)));
+    }
+
+    //RGB888 lines to other format, specialized per format at compile time
+    template <RawFormat Format>
+    struct RawConverter;
+
+    template <>
+    struct RawConverter<RawFormat::RGB888>
+    {
+        static size_t bytes(size_t w, size_t h)
+        {
+            return w * h * 3;
+        }
+
+        static void convert(const uint8_t* rgb, size_t w, size_t h, uint8_t* dst)
+        {
+            std::copy_n(rgb, bytes(w, h), dst);
+        }
+    };
+
+    template <>
+    struct RawConverter<RawFormat::RGB565>
+    {
+        static size_t bytes(size_t w, size_t h)
+        {
+            return w * h * 2;
+        }
+
+        static void convert(const uint8_t* rgb, size_t w, size_t h, uint8_t* dst)
+        {
+            const size_t count = w * h;
+            size_t i = 0;
+#ifdef __SSE2__
+            //channels are integers in float lanes, truncation gives exact bits
+            const __m128i bias = _mm_set1_epi32(0x8000);
+            for (; i + 16 <= count; i += 16)
+            {
+                __m128 r[4], g[4], b[4];
+                loadRGB16(rgb + i * 3, r, g, b);
+                __m128i v[4];
+                for (int k = 0; k < 4; ++k)
+                {
+                    const __m128i ri = _mm_slli_epi32(_mm_srli_epi32(_mm_cvttps_epi32(r[k]), 3), 11);
+                    const __m128i gi = _mm_slli_epi32(_mm_srli_epi32(_mm_cvttps_epi32(g[k]), 2), 5);
+                    const __m128i bi = _mm_srli_epi32(_mm_cvttps_epi32(b[k]), 3);
+                    //signed saturation of pack must not touch values above 0x7FFF
+                    v[k] = _mm_sub_epi32(_mm_or_si128(_mm_or_si128(ri, gi), bi), bias);
+                }
+                const __m128i sign = _mm_set1_epi16(static_cast<short>(0x8000));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 2), _mm_xor_si128(_mm_packs_epi32(v[0], v[1]), sign));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 2 + 16), _mm_xor_si128(_mm_packs_epi32(v[2], v[3]), sign));
+            }
+#endif
+            for (; i < count; ++i)
+            {
+                const uint8_t* p = rgb + i * 3;
+                const auto v = static_cast<uint16_t>(((p[0] & 0xF8) << 8) | ((p[1] & 0xFC) << 3) | (p[2] >> 3));
+                dst[i * 2] = static_cast<uint8_t>(v);
+                dst[i * 2 + 1] = static_cast<uint8_t>(v >> 8);
+            }
+        }
+    };
+
+    template <>
+    struct RawConverter<RawFormat::GRAY8>
+    {
+        static size_t bytes(size_t w, size_t h)
+        {
+            return w * h;
+        }
+
+        static void convert(const uint8_t* rgb, size_t w, size_t h, uint8_t* dst)
+        {
+            convertLine(rgb, w * h, dst);
+        }
+
+        //luma of count pixels, used for Y plane of YUV420 too
+        static void convertLine(const uint8_t* rgb, size_t count, uint8_t* dst)
+        {
+            size_t i = 0;
+#ifdef __SSE2__
+            for (; i + 16 <= count; i += 16)
+            {
+                __m128 r[4], g[4], b[4];
+                loadRGB16(rgb + i * 3, r, g, b);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), weightedBytes16(r, g, b, 0.299f, 0.587f, 0.114f, 0.f));
+            }
+#endif
+            for (; i < count; ++i)
+            {
+                const uint8_t* p = rgb + i * 3;
+                dst[i] = clampByte(0.299f * p[0] + 0.587f * p[1] + 0.114f * p[2]);
+            }
+        }
+    };
+
+    template <>
+    struct RawConverter<RawFormat::YUV420>
+    {
+        static size_t bytes(size_t w, size_t h)
+        {
+            return w * h + 2 * ((w + 1) / 2) * ((h + 1) / 2);
+        }
+
+#ifdef __SSE2__
+        //2x2 averages of 32 pixels of two lines, 16 chroma samples as 4 float vectors per channel
+        static void average32(const uint8_t* line0, const uint8_t* line1, __m128 (&r)[4], __m128 (&g)[4], __m128 (&b)[4])
+        {
+            __m128* out[3] = {r, g, b};
+            for (int half = 0; half < 2; ++half)
+            {
+                __m128 top[3][4], bottom[3][4];
+                loadRGB16(line0 + half * 48, top[0], top[1], top[2]);
+                loadRGB16(line1 + half * 48, bottom[0], bottom[1], bottom[2]);
+                for (int c = 0; c < 3; ++c)
+                    for (int k = 0; k < 2; ++k)
+                    {
+                        //columns of 8 pixels summed vertically, then even + odd lanes
+                        const __m128 lo = _mm_add_ps(top[c][k * 2], bottom[c][k * 2]);
+                        const __m128 hi = _mm_add_ps(top[c][k * 2 + 1], bottom[c][k * 2 + 1]);
+                        const __m128 sum = _mm_add_ps(_mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0)),
+                                                      _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1)));
+                        out[c][half * 2 + k] = _mm_mul_ps(sum, _mm_set1_ps(0.25f));
+                    }
+            }
+        }
+#endif
+
+        static void convert(const uint8_t* rgb, size_t w, size_t h, uint8_t* dst)
+        {
+            RawConverter<RawFormat::GRAY8>::convert(rgb, w, h, dst);
+
+            //chroma of 2x2 averages, odd last row/column averages what exists
+            const size_t cw = (w + 1) / 2;
+            const size_t ch = (h + 1) / 2;
+            uint8_t* u = dst + w * h;
+            uint8_t* v = u + cw * ch;
+            for (size_t cy = 0; cy < ch; ++cy)
+            {
+                const size_t y0 = cy * 2;
+                const size_t y1 = std::min(y0 + 1, h - 1);
+                size_t cx = 0;
+#ifdef __SSE2__
+                for (; cx * 2 + 32 <= w; cx += 16)
+                {
+                    __m128 r[4], g[4], b[4];
+                    average32(rgb + (y0 * w + cx * 2) * 3, rgb + (y1 * w + cx * 2) * 3, r, g, b);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(u + cy * cw + cx),
+                                     weightedBytes16(r, g, b, -0.168736f, -0.331264f, 0.5f, 128.f));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(v + cy * cw + cx),
+                                     weightedBytes16(r, g, b, 0.5f, -0.418688f, -0.081312f, 128.f));
+                }
+#endif
+                for (; cx < cw; ++cx)
+                {
+                    const size_t x0 = cx * 2;
+                    const size_t x1 = std::min(x0 + 1, w - 1);
+                    const uint8_t* p[4] = {rgb + (y0 * w + x0) * 3, rgb + (y0 * w + x1) * 3,
+                                           rgb + (y1 * w + x0) * 3, rgb + (y1 * w + x1) * 3
+                                          };
+                    const float r = (p[0][0] + p[1][0] + p[2][0] + p[3][0]) * 0.25f;
+                    const float g = (p[0][1] + p[1][1] + p[2][1] + p[3][1]) * 0.25f;
+                    const float b = (p[0][2] + p[1][2] + p[2][2] + p[3][2]) * 0.25f;
+                    u[cy * cw + cx] = clampByte(-0.168736f * r - 0.331264f * g + 0.5f * b + 128.f);
+                    v[cy * cw + cx] = clampByte(0.5f * r - 0.418688f * g - 0.081312f * b + 128.f);
+                }
+            }
+        }
+    };
+
+    //appends w x h RGB888 picture converted to format
+    template <class Dst>
+    void appendConverted(RawFormat format, const uint8_t* rgb, size_t w, size_t h, Dst& out)
+    {
+        const auto run = [&](auto converter)
+        {
+            using Converter = decltype(converter);
+            const size_t at = out.size();
+            out.resize(at + Converter::bytes(w, h));
+            Converter::convert(rgb, w, h, out.data() + at);
+        };
+        switch (format)
+        {
+            case RawFormat::RGB565:
+                run(RawConverter<RawFormat::RGB565>());
+                break;
+            case RawFormat::GRAY8:
+                run(RawConverter<RawFormat::GRAY8>());
+                break;
+            case RawFormat::YUV420:
+                run(RawConverter<RawFormat::YUV420>());
+                break;
+            default:
+                run(RawConverter<RawFormat::RGB888>());
+                break;
+        }
+    }
 }
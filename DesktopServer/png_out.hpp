@@ -43,7 +43,8 @@ class TinyPngOut final
 private:
     std::uint32_t width;   // Measured in pixels
     std::uint32_t height;  // Measured in pixels
-    std::uint32_t lineSize;  // Measured in bytes, equal to (width * 3 + 1)
+    std::uint32_t bytesPerPixel;  // 3 for RGB, 1 for palette indexes
+    std::uint32_t lineSize;  // Measured in bytes, equal to (width * bytesPerPixel + 1)
 
     // Running state
     const Writer &output;
@@ -70,18 +71,29 @@ public:
     NO_NEW;
 
     explicit TinyPngOut(std::uint32_t w, std::uint32_t h, const Writer &out) :
+        TinyPngOut(w, h, out, nullptr, 0)
+    {
+    }
+
+    /*
+     * Palette variant (color type 3): pixels are 1 byte indexes into palette of paletteSize (1..256) RGB triplets.
+     */
+    explicit TinyPngOut(std::uint32_t w, std::uint32_t h, const Writer &out, const uint8_t* palette, size_t paletteSize) :
         // Set most of the fields
         width(w),
         height(h),
+        bytesPerPixel((palette) ? 1 : 3),
         output(out)
     {
+        if (palette && (paletteSize == 0 || paletteSize > 256))
+            throw std::domain_error("Invalid palette size");
 
         // Check arguments
         if (width == 0 || height == 0)
             throw std::domain_error("Zero width or height");
 
         // Compute and check data siezs
-        auto lineSz = static_cast<std::uint64_t>(width) * 3 + 1;
+        auto lineSz = static_cast<std::uint64_t>(width) * bytesPerPixel + 1;
         if (lineSz > std::numeric_limits<uint32_t>::max())
             throw std::length_error("Image too large");
         lineSize = static_cast<uint32_t>(lineSz);
@@ -101,7 +113,7 @@ public:
             throw std::length_error("Image too large");
 
         // Write header (not a pure header, but a couple of things concatenated together)
-        uint8_t header[] =    // 43 bytes long
+        uint8_t header[] =    // 33 bytes long
         {
             // PNG header
             0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A,
@@ -110,30 +122,54 @@ public:
             0x49, 0x48, 0x44, 0x52,
             0, 0, 0, 0,  // 'width' placeholder
             0, 0, 0, 0,  // 'height' placeholder
-            0x08, 0x02, 0x00, 0x00, 0x00,
+            0x08, static_cast<uint8_t>((palette) ? 0x03 : 0x02), 0x00, 0x00, 0x00,
             0, 0, 0, 0,  // IHDR CRC-32 placeholder
-            // IDAT chunk
-            0, 0, 0, 0,  // 'idatSize' placeholder
-            0x49, 0x44, 0x41, 0x54,
-            // DEFLATE data
-            0x08, 0x1D,
         };
         putBigUint32(width, &header[16]);
         putBigUint32(height, &header[20]);
-        putBigUint32(idatSize, &header[33]);
         crc = 0;
         crc32(&header[12], 17);
         putBigUint32(crc, &header[29]);
         write(header);
 
+        if (palette)
+        {
+            uint8_t plte[] =
+            {
+                0, 0, 0, 0,  // length placeholder
+                0x50, 0x4C, 0x54, 0x45,
+            };
+            const auto paletteBytes = static_cast<uint32_t>(paletteSize * 3);
+            putBigUint32(paletteBytes, plte);
+            write(plte);
+            output(palette, paletteBytes);
+            crc = 0;
+            crc32(&plte[4], 4);
+            crc32(palette, paletteBytes);
+            uint8_t plteCrc[4];
+            putBigUint32(crc, plteCrc);
+            write(plteCrc);
+        }
+
+        uint8_t idat[] =    // 10 bytes long
+        {
+            // IDAT chunk
+            0, 0, 0, 0,  // 'idatSize' placeholder
+            0x49, 0x44, 0x41, 0x54,
+            // DEFLATE data
+            0x08, 0x1D,
+        };
+        putBigUint32(idatSize, &idat[0]);
+        write(idat);
+
         crc = 0;
-        crc32(&header[37], 6);  // 0xD7245B6B
+        crc32(&idat[4], 6);  // 0xD7245B6B
     }
 
 
     /*
      * Writes 'count' pixels from the given array to the output stream. This reads count*3
-     * bytes from the array. Pixels are presented from top to bottom, left to right, and with
+     * bytes from the array (count bytes for palette). Pixels are presented from top to bottom, left to right, and with
      * subpixels in RGB order. This object keeps track of how many pixels were written and
      * various position variables. It is an error to write more pixels in total than width*height.
      * Once exactly width*height pixels have been written with this TinyPngOut object,
@@ -145,16 +181,16 @@ public:
     void write(const std::vector<uint8_t, Alloc>& src)
     {
         const size_t pixels_count = width * height;
-        if (pixels_count * 3 > src.size())
+        if (pixels_count * bytesPerPixel > src.size())
             throw std::length_error("Amount of expected pixels bigger then buffer.");
         write(src.data(), pixels_count);
     }
 
     void write(const uint8_t* pixels, size_t count)
     {
-        if (count > SIZE_MAX / 3)
+        if (count > SIZE_MAX / bytesPerPixel)
             throw std::length_error("Invalid argument");
-        count *= 3;  // Convert pixel count to byte count
+        count *= bytesPerPixel;  // Convert pixel count to byte count
         while (count > 0)
         {
             if (pixels == nullptr)
@@ -0,0 +1,198 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+/*
+ * "Quite OK Image" format (https://qoiformat.org), RGB only.
+ * Lossless, single pass, no entropy coder: run-length, 64 entries cache of
+ * recent colors and small differences to the previous pixel.
+ * Stream is compatible with the reference implementation (channels = 3).
+ */
+namespace qoi
+{
+    constexpr static uint8_t OP_INDEX = 0x00;
+    constexpr static uint8_t OP_DIFF  = 0x40;
+    constexpr static uint8_t OP_LUMA  = 0x80;
+    constexpr static uint8_t OP_RUN   = 0xC0;
+    constexpr static uint8_t OP_RGB   = 0xFE;
+    constexpr static uint8_t OP_RGBA  = 0xFF;
+    constexpr static uint8_t MASK_2   = 0xC0;
+
+    constexpr static size_t HEADER_SIZE = 14;
+    constexpr static uint8_t PADDING[8] = {0, 0, 0, 0, 0, 0, 0, 1};
+
+    //rgb packed into uint32 with alpha 255 in high byte
+    inline uint32_t pack(uint8_t r, uint8_t g, uint8_t b)
+    {
+        return 0xFF000000u | (static_cast<uint32_t>(b) << 16) | (static_cast<uint32_t>(g) << 8) | r;
+    }
+
+    inline int hash(uint32_t px)
+    {
+        const uint32_t r = px & 0xFF;
+        const uint32_t g = (px >> 8) & 0xFF;
+        const uint32_t b = (px >> 16) & 0xFF;
+        return static_cast<int>((r * 3 + g * 5 + b * 7 + 255 * 11) % 64);
+    }
+
+    inline uint8_t* putInt(uint8_t* p, uint32_t v)
+    {
+        p[0] = static_cast<uint8_t>(v >> 24);
+        p[1] = static_cast<uint8_t>(v >> 16);
+        p[2] = static_cast<uint8_t>(v >> 8);
+        p[3] = static_cast<uint8_t>(v);
+        return p + 4;
+    }
+
+    //appends QOI of RGB888 image w x h which has stride bytes per line
+    inline void encode(const uint8_t* rgb, int w, int h, size_t stride, std::vector<uint8_t>& out)
+    {
+        const size_t start = out.size();
+        //worst case is OP_RGB for each pixel
+        out.resize(start + HEADER_SIZE + static_cast<size_t>(w) * h * 4 + sizeof(PADDING));
+        uint8_t* p = out.data() + start;
+
+        std::memcpy(p, "qoif", 4);
+        p = putInt(p + 4, static_cast<uint32_t>(w));
+        p = putInt(p, static_cast<uint32_t>(h));
+        *p++ = 3; //channels
+        *p++ = 0; //sRGB
+
+        uint32_t index[64] = {};
+        uint32_t prev = pack(0, 0, 0);
+        int run = 0;
+
+        for (int y = 0; y < h; ++y)
+        {
+            const uint8_t* line = rgb + y * stride;
+            for (int x = 0; x < w; ++x, line += 3)
+            {
+                const uint32_t px = pack(line[0], line[1], line[2]);
+                if (px == prev)
+                {
+                    if (++run == 62)
+                    {
+                        *p++ = OP_RUN | (run - 1);
+                        run = 0;
+                    }
+                    continue;
+                }
+                if (run)
+                {
+                    *p++ = OP_RUN | (run - 1);
+                    run = 0;
+                }
+
+                const int idx = hash(px);
+                if (index[idx] == px)
+                    *p++ = OP_INDEX | idx;
+                else
+                {
+                    index[idx] = px;
+                    const int8_t vr = static_cast<int8_t>(line[0] - (prev & 0xFF));
+                    const int8_t vg = static_cast<int8_t>(line[1] - ((prev >> 8) & 0xFF));
+                    const int8_t vb = static_cast<int8_t>(line[2] - ((prev >> 16) & 0xFF));
+                    const int8_t vg_r = static_cast<int8_t>(vr - vg);
+                    const int8_t vg_b = static_cast<int8_t>(vb - vg);
+
+                    if (vr > -3 && vr < 2 && vg > -3 && vg < 2 && vb > -3 && vb < 2)
+                        *p++ = OP_DIFF | ((vr + 2) << 4) | ((vg + 2) << 2) | (vb + 2);
+                    else if (vg_r > -9 && vg_r < 8 && vg > -33 && vg < 32 && vg_b > -9 && vg_b < 8)
+                    {
+                        *p++ = OP_LUMA | (vg + 32);
+                        *p++ = static_cast<uint8_t>(((vg_r + 8) << 4) | (vg_b + 8));
+                    }
+                    else
+                    {
+                        *p++ = OP_RGB;
+                        *p++ = line[0];
+                        *p++ = line[1];
+                        *p++ = line[2];
+                    }
+                }
+                prev = px;
+            }
+        }
+        if (run)
+            *p++ = OP_RUN | (run - 1);
+
+        std::memcpy(p, PADDING, sizeof(PADDING));
+        p += sizeof(PADDING);
+        out.resize(static_cast<size_t>(p - out.data()));
+    }
+
+    //reference decoder to RGB888, returns false on malformed stream
+    inline bool decode(const uint8_t* data, size_t size, std::vector<uint8_t>& rgb, int& w, int& h)
+    {
+        const auto getInt = [](const uint8_t* p)
+        {
+            return (static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16) |
+                   (static_cast<uint32_t>(p[2]) << 8) | p[3];
+        };
+        if (size < HEADER_SIZE + sizeof(PADDING) || std::memcmp(data, "qoif", 4))
+            return false;
+        const uint32_t uw = getInt(data + 4);
+        const uint32_t uh = getInt(data + 8);
+        if (!uw || !uh || uw > 0x8000 || uh > 0x8000)
+            return false;
+        w = static_cast<int>(uw);
+        h = static_cast<int>(uh);
+
+        const size_t pixels = static_cast<size_t>(uw) * uh;
+        rgb.resize(pixels * 3);
+
+        uint8_t index[64][4] = {};
+        uint8_t px[4] = {0, 0, 0, 255};
+        const uint8_t* p = data + HEADER_SIZE;
+        const uint8_t* end = data + size - sizeof(PADDING);
+        int run = 0;
+
+        for (size_t i = 0; i < pixels; ++i)
+        {
+            if (run)
+                --run;
+            else
+            {
+                if (p >= end)
+                    return false;
+                const uint8_t b1 = *p++;
+                if (b1 == OP_RGB || b1 == OP_RGBA)
+                {
+                    const size_t n = (b1 == OP_RGB) ? 3 : 4;
+                    if (static_cast<size_t>(end - p) < n)
+                        return false;
+                    std::memcpy(px, p, n);
+                    p += n;
+                }
+                else if ((b1 & MASK_2) == OP_INDEX)
+                    std::memcpy(px, index[b1], 4);
+                else if ((b1 & MASK_2) == OP_DIFF)
+                {
+                    px[0] += ((b1 >> 4) & 3) - 2;
+                    px[1] += ((b1 >> 2) & 3) - 2;
+                    px[2] += (b1 & 3) - 2;
+                }
+                else if ((b1 & MASK_2) == OP_LUMA)
+                {
+                    if (p >= end)
+                        return false;
+                    const uint8_t b2 = *p++;
+                    const int vg = (b1 & 0x3F) - 32;
+                    px[0] += vg - 8 + ((b2 >> 4) & 0x0F);
+                    px[1] += vg;
+                    px[2] += vg - 8 + (b2 & 0x0F);
+                }
+                else
+                    run = b1 & 0x3F;
+
+                const int idx = (px[0] * 3 + px[1] * 5 + px[2] * 7 + px[3] * 11) % 64;
+                std::memcpy(index[idx], px, 4);
+            }
+            std::memcpy(rgb.data() + i * 3, px, 3);
+        }
+        return true;
+    }
+}
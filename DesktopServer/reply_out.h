@@ -0,0 +1,194 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <ostream>
+#include <vector>
+#include "network.h"
+#include "spinlock.h"
+#include "guard_on.h"
+#include "cm_ctors.h"
+#include "span_codec.h"
+
+using SocketWriteLock = spinlock;
+
+//Everything server sends goes through here. Small replies are marshaled into connection's output buffer,
+//frame packets wait in short queue. Connection thread takes both under the lock and writes them to socket
+//without it, so slow client never blocks threads which produce replies.
+class ReplyOut
+{
+public:
+    ReplyOut() = delete;
+    NO_COPYMOVE(ReplyOut);
+    ReplyOut(std::ostream& os, SocketWriteLock& socket_write_lock): os(os), socket_write_lock(socket_write_lock) {}
+
+    template <class Reply>
+    void send(const Reply& reply)
+    {
+        LOCK_GUARD_ON(socket_write_lock);
+        reply.marshal(os);
+    }
+
+    //few replies which must not be separated by others
+    template <class Marshal>
+    void sendTogether(const Marshal& marshal)
+    {
+        LOCK_GUARD_ON(socket_write_lock);
+        marshal(os);
+    }
+
+    //0 - frames are sent whole
+    void setChunkSize(size_t size)
+    {
+        chunk_size = size;
+    }
+
+    //called from connection thread when frame was refused before and queue has room again
+    void setDrainedCallback(std::function<void()> callback)
+    {
+        drained = std::move(callback);
+    }
+
+    //false while MAX_QUEUED_FRAMES are queued or being sent: frame must not be encoded then,
+    //client is behind and would get stale pictures only; drained callback is called once there is room
+    bool frameSlotFree()
+    {
+        LOCK_GUARD_ON(socket_write_lock);
+        const bool free = frame_queue.size() + ((frame_sending) ? 1 : 0) < MAX_QUEUED_FRAMES;
+        refused = refused || !free;
+        return free;
+    }
+
+    //whole marshaled reply::frame goes to queue, packet is left empty and possibly with capacity of already sent one;
+    //slices of frame which got the slot are queued over the limit.
+    //Purgeable frame may be dropped by purgeLastFrame() while it is the last one and did not start going out.
+    //Lead is marshaled replies which belong to the frame, they are sent right before it or dropped with it.
+    void sendFrame(std::vector<uint8_t>& packet, bool purgeable = false, const std::vector<uint8_t>* lead = nullptr)
+    {
+        LOCK_GUARD_ON(socket_write_lock);
+        frame_queue.push_back(QueuedFrame{std::move(packet), purgeable, {}});
+        if (lead)
+            frame_queue.back().lead = *lead;
+        packet.clear();
+        if (!frame_spare.empty())
+        {
+            packet.swap(frame_spare.back());
+            frame_spare.pop_back();
+        }
+    }
+
+    //true if the last queued frame was purgeable and is dropped
+    bool purgeLastFrame()
+    {
+        LOCK_GUARD_ON(socket_write_lock);
+        if (frame_queue.empty() || !frame_queue.back().purgeable)
+            return false;
+        frame_queue.pop_back();
+        return true;
+    }
+
+    //connection thread: replies from buffer and next chunk of the oldest frame are taken under the lock
+    //and written after it is released; returns false when there was nothing to send
+    template <class Predicate>
+    bool flush(boost::asio::streambuf& buffer, const network::SocketPtr& socket, Predicate& should_break)
+    {
+        replies.clear();
+        {
+            lock_guard_conditional<SocketWriteLock, Predicate> grd(socket_write_lock, should_break);
+            if (!grd.isLocked())
+                return false;
+            const auto begin = boost::asio::buffers_begin(buffer.data());
+            replies.assign(begin, begin + static_cast<std::ptrdiff_t>(buffer.size()));
+            buffer.consume(buffer.size());
+            if (!frame_sending && !frame_queue.empty())
+            {
+                const auto& lead = frame_queue.front().lead;
+                replies.insert(replies.end(), lead.begin(), lead.end());
+                sending.swap(frame_queue.front().packet);
+                frame_queue.pop_front();
+                frame_sending = true;
+            }
+        }
+        if (!replies.empty())
+            boost::asio::write(*socket, boost::asio::buffer(replies));
+        if (!frame_sending)
+            return !replies.empty();
+        sendChunk(socket);
+        return true;
+    }
+
+    //smaller chunks requested by client are enlarged to it, header would cost too much
+    constexpr static size_t MIN_CHUNK_SIZE = 4 * 1024;
+    //frames queued and being sent, encoder skips pictures above it
+    constexpr static size_t MAX_QUEUED_FRAMES = 2;
+
+private:
+    std::ostream& os;
+    SocketWriteLock& socket_write_lock;
+
+    struct QueuedFrame
+    {
+        std::vector<uint8_t> packet;
+        bool purgeable;
+        std::vector<uint8_t> lead;
+    };
+
+    std::atomic<size_t> chunk_size{0};
+    //touched under socket_write_lock: frames waiting, sent packets kept for their capacity,
+    //frame was refused since the queue was full last time
+    std::deque<QueuedFrame> frame_queue;
+    std::vector<std::vector<uint8_t>> frame_spare;
+    bool frame_sending{false};
+    bool refused{false};
+    std::function<void()> drained;
+
+    //connection thread only: frame being sent and bytes of it sent, replies taken from buffer
+    std::vector<uint8_t> sending;
+    size_t frame_sent{0};
+    std::vector<uint8_t> chunk_header;
+    std::vector<uint8_t> replies;
+
+    //next chunk of frame being sent, replies written meanwhile go out between chunks
+    void sendChunk(const network::SocketPtr& socket)
+    {
+        namespace span = protocol::span;
+        //frame which was started in chunks is finished in chunks even if client turned them off
+        const size_t size = (chunk_size || !frame_sent) ? chunk_size.load() : MIN_CHUNK_SIZE;
+        const size_t n = (size) ? std::min(size, sending.size() - frame_sent) : sending.size();
+
+        chunk_header.clear();
+        if (size)
+        {
+            using Chunk = protocol::broadcast::reply::chunk;
+            span::Writer writer(chunk_header);
+            writer.header(span::messageId<Chunk>(), 3);
+            writer.putInt(span::label<&Chunk::offset>(), static_cast<int64_t>(frame_sent));
+            writer.putInt(span::label<&Chunk::total>(), static_cast<int64_t>(sending.size()));
+            writer.binaryHeader(span::label<&Chunk::data>(), n);
+        }
+        const std::array<boost::asio::const_buffer, 2> buffers =
+        {
+            boost::asio::buffer(chunk_header),
+            boost::asio::buffer(sending.data() + frame_sent, n),
+        };
+        boost::asio::write(*socket, buffers);
+
+        frame_sent += n;
+        if (frame_sent < sending.size())
+            return;
+        frame_sent = 0;
+        bool wake = false;
+        {
+            LOCK_GUARD_ON(socket_write_lock);
+            if (frame_spare.size() < MAX_QUEUED_FRAMES)
+                frame_spare.push_back(std::move(sending));
+            sending.clear();
+            frame_sending = false;
+            wake = refused;
+            refused = false;
+        }
+        if (wake && drained)
+            drained();
+    }
+};
@@ -0,0 +1,93 @@
+//XComposite window capture check, ctest runs it under Xvfb.
+//Window with thick border is fully covered by another one, captured picture must still be its own content
+//starting right at the top left corner (no border, no cover). Exit code 77 means there is no X display to test on.
+#include "ScreenCapture.h"
+#include <X11/Xlib.h>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+constexpr int WIN_W = 200;
+constexpr int WIN_H = 100;
+constexpr int BORDER = 7;
+constexpr unsigned long CONTENT_COLOR = 0x3080C0;
+constexpr unsigned long BORDER_COLOR = 0xFF0000;
+constexpr unsigned long COVER_COLOR = 0x00FF00;
+
+static bool isContent(const SL::Screen_Capture::ImageBGRA& p)
+{
+    return p.R == 0x30 && p.G == 0x80 && p.B == 0xC0;
+}
+
+int main()
+{
+    using namespace std::chrono_literals;
+    Display* display = XOpenDisplay(nullptr);
+    if (!display)
+    {
+        std::cout << "No X display, skipped." << std::endl;
+        return 77;
+    }
+    const auto root = DefaultRootWindow(display);
+    const auto target = XCreateSimpleWindow(display, root, 20, 20, WIN_W, WIN_H, BORDER, BORDER_COLOR, CONTENT_COLOR);
+    XStoreName(display, target, "composite capture test");
+    const auto cover = XCreateSimpleWindow(display, root, 0, 0, WIN_W + 2 * BORDER + 40, WIN_H + 2 * BORDER + 40, 0, 0, COVER_COLOR);
+    XMapWindow(display, target);
+    XMapRaised(display, cover);
+    XSync(display, False);
+
+    std::atomic<int> frames{0};
+    std::atomic<bool> passed{false};
+    std::atomic<uint32_t> seen{0};
+
+    SL::Screen_Capture::Window window = {};
+    window.Handle = static_cast<size_t>(target);
+    window.Size = SL::Screen_Capture::Point{WIN_W, WIN_H};
+    window.Name = "composite capture test";
+
+    auto grabber = SL::Screen_Capture::CreateCaptureConfiguration([&window]()
+    {
+        return std::vector<SL::Screen_Capture::Window> {window};
+    })->onNewFrame([&](const SL::Screen_Capture::Image& img, const SL::Screen_Capture::Window&)
+    {
+        using namespace SL::Screen_Capture;
+        ++frames;
+        if (Width(img) != WIN_W || Height(img) != WIN_H)
+            return;
+        const auto first = StartSrc(img);
+        auto last_row = first;
+        for (int j = 1; j < Height(img); ++j)
+            last_row = GotoNextRow(img, last_row);
+        const auto& p = *first;
+        seen = (static_cast<uint32_t>(p.R) << 16) | (p.G << 8) | p.B;
+        if (isContent(*first) && isContent(last_row[WIN_W - 1]))
+            passed = true;
+    })->start_capturing();
+    grabber->setFrameChangeInterval(50ms);
+
+    //window is painted by hand, so content is there whatever redirection did to it
+    const auto gc = XCreateGC(display, target, 0, nullptr);
+    XSetForeground(display, gc, CONTENT_COLOR);
+    for (int i = 0; i < 100 && !passed; ++i)
+    {
+        XFillRectangle(display, target, gc, 0, 0, WIN_W, WIN_H);
+        XSync(display, False);
+        std::this_thread::sleep_for(50ms);
+    }
+    grabber.reset();
+
+    XFreeGC(display, gc);
+    XDestroyWindow(display, cover);
+    XDestroyWindow(display, target);
+    XCloseDisplay(display);
+
+    if (!passed)
+    {
+        std::cout << "Failed: " << frames << " frames, top left pixel " << std::hex << seen << " instead of "
+                  << CONTENT_COLOR << std::endl;
+        return 1;
+    }
+    std::cout << "Passed, " << frames << " frames." << std::endl;
+    return 0;
+}
@@ -33,6 +33,9 @@ namespace SL
         {
             Point Position;
             Point HotSpot;
+            // identifies cursor image, same serial means same image, so it can be cached by receiver;
+            // X11 cursor serial on linux, counter of image changes elsewhere, 0 before the first image
+            unsigned long Serial = 0;
         };
         struct SC_LITE_EXTERN Window
         {
@@ -92,6 +95,9 @@ namespace SL
         SC_LITE_EXTERN void Width(Window &mointor, int w);
         SC_LITE_EXTERN int Height(const Image &img);
         SC_LITE_EXTERN int Width(const Image &img);
+        // position of the image inside captured monitor/window, non zero for images passed to onFrameChanged
+        SC_LITE_EXTERN int OffsetX(const Image &img);
+        SC_LITE_EXTERN int OffsetY(const Image &img);
         SC_LITE_EXTERN int X(const Point &p);
         SC_LITE_EXTERN int Y(const Point &p);
 
@@ -99,6 +105,8 @@ namespace SL
         SC_LITE_EXTERN const ImageBGRA *StartSrc(const Image &img);
         SC_LITE_EXTERN const ImageBGRA *GotoNextRow(const Image &img, const ImageBGRA *current);
         SC_LITE_EXTERN bool isDataContiguous(const Image &img);
+        // false when OnNewFrame got the same picture as before, requires onFrameChanged to be set (otherwise always true)
+        SC_LITE_EXTERN bool isChanged(const Image &img);
         /*
             this is the ONLY funcion for pulling data out of the Image object and is layed out here in the header so that
             users can see how to extra data and convert it to their own needed format. Initially, I included custom extract functions
@@ -154,6 +162,9 @@ namespace SL
         SC_LITE_EXTERN std::vector<Monitor> GetMonitors();
         // will return all windows
         SC_LITE_EXTERN std::vector<Window> GetWindows();
+        // will return up to max_count windows which names contain name_part (case insensitive), exact matches first.
+        // Uses registry updated by window manager events, so unlike GetWindows() it does not query X server on each call
+        SC_LITE_EXTERN std::vector<Window> FindWindows(const std::string &name_part, size_t max_count = 1);
 
         typedef std::function<void(const SL::Screen_Capture::Image &img, const Window &window)> WindowCaptureCallback;
         typedef std::function<void(const SL::Screen_Capture::Image &img, const Monitor &monitor)> ScreenCaptureCallback;
@@ -179,6 +190,15 @@ namespace SL
 
             virtual void setFrameChangeInterval(const std::shared_ptr<Timer> &timer) = 0;
             virtual void setMouseChangeInterval(const std::shared_ptr<Timer> &timer) = 0;
+            // While frames do not change the frame interval doubles on each frame, up to max_multiplier times.
+            // First change or mouse activity restores it. 1 (default) keeps fixed rate.
+            virtual void setIdleBackoff(int max_multiplier) = 0;
+            // Restores full frame rate the same way mouse activity does, for callers which have work pending on next frames.
+            virtual void notifyActivity() = 0;
+            // Next frames grab only the region at position of size (pixels of captured monitor/window), the rest of the
+            // picture keeps previous content and is grabbed whole once per full_every frames. Zero size (default) grabs
+            // whole picture each frame.
+            virtual void setCropRegion(const Point &position, const Point &size, int full_every) = 0;
 
             // Will pause all capturing
             virtual void pause() = 0;
@@ -194,7 +214,7 @@ namespace SL
             virtual ~ICaptureConfiguration() {}
             // When a new frame is available the callback is invoked
             virtual std::shared_ptr<ICaptureConfiguration<CAPTURECALLBACK>> onNewFrame(const CAPTURECALLBACK &cb) = 0;
-            // When a change in a frame is detected, the callback is invoked
+            // When a change in a frame is detected, the callback is invoked (for each changed rectangle, before onNewFrame of the same frame)
             virtual std::shared_ptr<ICaptureConfiguration<CAPTURECALLBACK>> onFrameChanged(const CAPTURECALLBACK &cb) = 0;
             // When a mouse image changes or the mouse changes position, the callback is invoked.
             virtual std::shared_ptr<ICaptureConfiguration<CAPTURECALLBACK>> onMouseChanged(const MouseCallback &cb) = 0;
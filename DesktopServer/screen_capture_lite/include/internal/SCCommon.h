@@ -26,6 +26,8 @@ namespace SL
             ImageRect Bounds;
             int BytesToNextRow = 0;
             bool isContiguous = false;
+            // false if frame is the same as previous one, known only when OnFrameChanged is set
+            bool isChanged = true;
             // alpha is always unused and might contain garbage
             const ImageBGRA *Data = nullptr;
         };
@@ -38,6 +40,13 @@ namespace SL
         int Width(const ImageRect &rect);
         const ImageRect &Rect(const Image &img);
 
+        // part of the picture grabbed each frame, whole one is grabbed once per FullEvery frames
+        struct CropRegion
+        {
+            ImageRect Rect;
+            int FullEvery = 1;
+        };
+
         template <typename F, typename M, typename W> struct CaptureData
         {
             std::shared_ptr<Timer> FrameTimer;
@@ -57,6 +66,12 @@ namespace SL
             // Used to signal to threads to exit
             std::atomic<bool> TerminateThreadsEvent;
             std::atomic<bool> Paused;
+            // frame interval may grow up to this many times while picture is static, 1 means fixed rate
+            std::atomic<int> MaxIdleBackoff;
+            // increased on any user visible activity (i.e. cursor), capture threads return to full rate
+            std::atomic<unsigned> ActivityCounter;
+            // set by setCropRegion(), accessed by atomic_load/atomic_store, null - whole picture each frame
+            std::shared_ptr<CropRegion> Crop;
         };
         struct Thread_Data
         {
@@ -73,6 +88,8 @@ namespace SL
             std::unique_ptr<unsigned char[]> ImageBuffer;
             size_t ImageBufferSize = 0;
             bool FirstRun = true;
+            // result of the last ProcessCapture, true if unknown
+            bool LastFrameChanged = true;
         };
 
         enum DUPL_RETURN { DUPL_RETURN_SUCCESS = 0, DUPL_RETURN_ERROR_EXPECTED = 1, DUPL_RETURN_ERROR_UNEXPECTED = 2 };
@@ -95,29 +112,37 @@ namespace SL
             const auto sizeofimgbgra = static_cast<int>(sizeof(ImageBGRA));
             const auto startimgsrc = reinterpret_cast<const ImageBGRA *>(startsrc);
             auto dstrowstride = sizeofimgbgra * Width(mointor);
-            if (data.OnNewFrame)   // each frame we still let the caller know if asked for
+            // difs are computed before callbacks, so OnNewFrame knows if anything changed at all
+            std::vector<ImageRect> imgdifs;
+            const bool firstrun = base.FirstRun;
+            if (data.OnFrameChanged && !firstrun)
             {
-                auto wholeimg = CreateImage(imageract, srcrowstride, startimgsrc);
-                wholeimg.isContiguous = dstrowstride == srcrowstride;
-                data.OnNewFrame(wholeimg, mointor);
+                auto newimg = CreateImage(imageract, srcrowstride - dstrowstride, startimgsrc);
+                auto oldimg = CreateImage(imageract, 0, reinterpret_cast<const ImageBGRA *>(base.ImageBuffer.get()));
+                imgdifs = GetDifs(oldimg, newimg);
             }
+            base.LastFrameChanged = !data.OnFrameChanged || firstrun || !imgdifs.empty();
             if (data.OnFrameChanged)   // difs are needed!
             {
-                if (base.FirstRun)
+                auto startdst = base.ImageBuffer.get();
+                if (firstrun)
                 {
                     // first time through, just send the whole image
                     auto wholeimg = CreateImage(imageract, srcrowstride, startimgsrc);
                     wholeimg.isContiguous = dstrowstride == srcrowstride;
                     data.OnFrameChanged(wholeimg, mointor);
                     base.FirstRun = false;
+
+                    if (dstrowstride == srcrowstride)   // no need for multiple calls, there is no padding here
+                        memcpy(startdst, startsrc, dstrowstride * Height(mointor));
+                    else
+                    {
+                        for (auto i = 0; i < Height(mointor); i++)
+                            memcpy(startdst + (i * dstrowstride), startsrc + (i * srcrowstride), dstrowstride);
+                    }
                 }
                 else
                 {
-                    // user wants difs, lets do it!
-                    auto newimg = CreateImage(imageract, srcrowstride - dstrowstride, startimgsrc);
-                    auto oldimg = CreateImage(imageract, 0, reinterpret_cast<const ImageBGRA *>(base.ImageBuffer.get()));
-                    auto imgdifs = GetDifs(oldimg, newimg);
-
                     for (auto &r : imgdifs)
                     {
                         auto leftoffset = r.left * sizeofimgbgra;
@@ -126,16 +151,22 @@ namespace SL
                         auto difimg = CreateImage(r, srcrowstride, reinterpret_cast<const ImageBGRA *>(thisstartsrc));
                         difimg.isContiguous = false;
                         data.OnFrameChanged(difimg, mointor);
+
+                        // reference buffer gets only changed parts, static screen costs no copying at all
+                        auto thisstartdst = startdst + leftoffset + (r.top * dstrowstride);
+                        const auto rowbytes = Width(r) * sizeofimgbgra;
+                        for (auto i = 0; i < Height(r); i++)
+                            memcpy(thisstartdst + (i * dstrowstride), thisstartsrc + (i * srcrowstride), rowbytes);
                     }
                 }
-                auto startdst = base.ImageBuffer.get();
-                if (dstrowstride == srcrowstride)   // no need for multiple calls, there is no padding here
-                    memcpy(startdst, startsrc, dstrowstride * Height(mointor));
-                else
-                {
-                    for (auto i = 0; i < Height(mointor); i++)
-                        memcpy(startdst + (i * dstrowstride), startsrc + (i * srcrowstride), dstrowstride);
-                }
+            }
+            // called after changed rectangles, so receiver can use them for the whole frame
+            if (data.OnNewFrame)   // each frame we still let the caller know if asked for
+            {
+                auto wholeimg = CreateImage(imageract, srcrowstride, startimgsrc);
+                wholeimg.isContiguous = dstrowstride == srcrowstride;
+                wholeimg.isChanged = base.LastFrameChanged;
+                data.OnNewFrame(wholeimg, mointor);
             }
         }
     } // namespace Screen_Capture
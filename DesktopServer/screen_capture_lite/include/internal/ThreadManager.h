@@ -1,6 +1,7 @@
 #pragma once
 #include "internal/SCCommon.h"
 #include "ScreenCapture.h"
+#include <algorithm>
 #include <atomic>
 #include <iostream>
 #include <memory>
@@ -28,12 +29,46 @@ namespace SL
             void Join();
         };
 
+        // Exponential backoff of the capture rate while picture is static.
+        // Any change of the frame or activity reported by other threads restores the full rate.
+        class IdleBackoff
+        {
+            int Multiplier = 1;
+            unsigned SeenActivity = 0;
+
+        public:
+            // must be called after the regular frame timer wait
+            template <class F> void wait(const F &data, bool framechanged, std::chrono::microseconds period)
+            {
+                auto &common = data->CommonData_;
+                const int maxmultiplier = common.MaxIdleBackoff;
+                const auto activity = common.ActivityCounter.load();
+                if (framechanged || activity != SeenActivity || maxmultiplier < 2)
+                {
+                    SeenActivity = activity;
+                    Multiplier = 1;
+                    return;
+                }
+                Multiplier = std::min(Multiplier * 2, maxmultiplier);
+
+                // one period is already waited by timer, rest is slept in small steps to react on activity fast
+                const auto until = std::chrono::steady_clock::now() + period * (Multiplier - 1);
+                while (!common.TerminateThreadsEvent && !common.Paused && common.ActivityCounter == SeenActivity)
+                {
+                    const auto now = std::chrono::steady_clock::now();
+                    if (now >= until)
+                        break;
+                    std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(10ms, until - now));
+                }
+            }
+        };
+
         template <class T, class F, class... E> bool TryCaptureMouse(const F &data, E... args)
         {
             T frameprocessor;
             frameprocessor.ImageBufferSize = frameprocessor.MaxCursurorSize * frameprocessor.MaxCursurorSize * sizeof(ImageBGRA);
             frameprocessor.ImageBuffer = std::make_unique<unsigned char[]>(frameprocessor.ImageBufferSize);
-            auto ret = frameprocessor.Init(data);
+            auto ret = frameprocessor.Init(data, args...);
             if (ret != DUPL_RETURN_SUCCESS)
                 return false;
             while (!data->CommonData_.TerminateThreadsEvent)
@@ -105,6 +140,7 @@ namespace SL
             auto ret = frameprocessor.Init(data, monitor);
             if (ret != DUPL_RETURN_SUCCESS)
                 return false;
+            IdleBackoff backoff;
 
             while (!data->CommonData_.TerminateThreadsEvent)
             {
@@ -138,6 +174,7 @@ namespace SL
                     return true;
                 }
                 timer->wait();
+                backoff.wait(data, frameprocessor.LastFrameChanged, timer->duration());
                 while (data->CommonData_.Paused)
                 {
                     frameprocessor.Pause();
@@ -159,6 +196,7 @@ namespace SL
             auto ret = frameprocessor.Init(data, wnd);
             if (ret != DUPL_RETURN_SUCCESS)
                 return false;
+            IdleBackoff backoff;
             while (!data->CommonData_.TerminateThreadsEvent)
             {
                 // get a copy of the shared_ptr in a safe way
@@ -182,6 +220,7 @@ namespace SL
                     return true;
                 }
                 timer->wait();
+                backoff.wait(data, frameprocessor.LastFrameChanged, timer->duration());
                 while (data->CommonData_.Paused)
                     std::this_thread::sleep_for(50ms);
             }
@@ -192,5 +231,7 @@ namespace SL
         void RunCaptureWindow(std::shared_ptr<Thread_Data> data, Window window);
 
         void RunCaptureMouse(std::shared_ptr<Thread_Data> data);
+        // mouse position is relative to the window
+        void RunCaptureMouse(std::shared_ptr<Thread_Data> data, Window window);
     } // namespace Screen_Capture
 } // namespace SL
@@ -10,6 +10,8 @@ namespace SL {
         class NSMouseProcessor: public BaseFrameProcessor {
             int Last_x =0;
             int Last_y =0;
+            // MousePoint::Serial, changes with cursor image
+            unsigned long ShapeSerial = 0;
             std::unique_ptr<unsigned char[]> OldImageBuffer;
         public:
             const int MaxCursurorSize=32;
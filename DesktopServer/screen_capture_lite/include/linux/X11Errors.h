@@ -0,0 +1,80 @@
+#pragma once
+#include <X11/Xlib.h>
+#include <X11/Xproto.h>
+#include <mutex>
+
+namespace SL
+{
+    namespace Screen_Capture
+    {
+        //Windows may be destroyed at any moment while their ids are still used by the registry and capture threads,
+        //default Xlib handler exits the process on the first BadWindow then. While trap is alive on a thread,
+        //BadWindow and BadDrawable of its display are counted instead; any other error, error of other display
+        //or error which comes outside of traps goes to the handler which was installed before (i.e. BadMatch does).
+        //Requests without reply report errors later, so trap syncs before it ends if some are still unanswered.
+        class X11ErrorTrap
+        {
+        public:
+            X11ErrorTrap(const X11ErrorTrap&) = delete;
+            X11ErrorTrap& operator=(const X11ErrorTrap&) = delete;
+
+            explicit X11ErrorTrap(Display* display): display(display), outer(current())
+            {
+                install();
+                current() = this;
+            }
+
+            ~X11ErrorTrap()
+            {
+                if (display && LastKnownRequestProcessed(display) + 1 != NextRequest(display))
+                    XSync(display, False);
+                current() = outer;
+            }
+
+            //some request made in scope was about window or drawable which is gone, errors so far only
+            bool failed() const
+            {
+                return errors > 0;
+            }
+
+        private:
+            Display* display;
+            X11ErrorTrap* outer;
+            int errors{0};
+
+            static X11ErrorTrap*& current()
+            {
+                thread_local X11ErrorTrap* trap = nullptr;
+                return trap;
+            }
+
+            static XErrorHandler& previous()
+            {
+                static XErrorHandler handler = nullptr;
+                return handler;
+            }
+
+            static int onError(Display* display, XErrorEvent* error)
+            {
+                if (error->error_code == BadWindow || error->error_code == BadDrawable)
+                    for (auto trap = current(); trap; trap = trap->outer)
+                        if (trap->display == display)
+                        {
+                            ++trap->errors;
+                            return 0;
+                        }
+                return (previous()) ? previous()(display, error) : 0;
+            }
+
+            //handler is process wide, it is installed once by the first trap
+            static void install()
+            {
+                static std::once_flag once;
+                std::call_once(once, []()
+                {
+                    previous() = XSetErrorHandler(&X11ErrorTrap::onError);
+                });
+            }
+        };
+    }
+}
@@ -4,6 +4,7 @@
 #include <X11/Xlib.h>
 #include <sys/shm.h>
 #include <X11/extensions/XShm.h>
+#include <X11/extensions/Xcomposite.h>
 
 namespace SL
 {
@@ -17,8 +18,40 @@ namespace SL
             XID SelectedWindow = 0;
             XImage* XImage_ = nullptr;
             std::unique_ptr<XShmSegmentInfo> ShmInfo;
+            size_t ShmSize = 0; //real size of the shared segment, may be bigger then current XImage_ needs
             Monitor SelectedMonitor;
 
+            //(re)creates XImage_ of given size, shared segment is reused while it is big enough
+            bool CreateShmImage(int width, int height, size_t min_segment_size = 0);
+            void FreeShmSegment();
+            //window was resized, updates buffers in place instead of full restart
+            bool ResizeWindowImage(Window& selectedwindow, int width, int height);
+
+            //window geometry and visibility are read once, then they follow ConfigureNotify/MapNotify/UnmapNotify
+            //instead of polling attributes each frame; with XComposite content is valid even if window is covered
+            Pixmap CompositePixmap = 0;
+            bool CompositeRedirected = false;
+            bool WindowMapped = true;
+            int EventWidth = 0;
+            int EventHeight = 0;
+            //window pixmap includes the border, content starts at (BorderWidth, BorderWidth)
+            int BorderWidth = 0;
+
+            bool WatchWindow();
+            bool InitComposite();
+            void NameCompositePixmap();
+            DUPL_RETURN ProcessWindowEvents(Window& selectedwindow);
+
+            //cropped grabs: region goes into its own image placed in the segment right after XImage_,
+            //then it is copied into XImage_ which keeps the rest of previous frame
+            XImage* CropImage_ = nullptr;
+            int FramesSinceFull = 0;
+
+            bool UseCrop(ImageRect& part);
+            bool GrabPart(Drawable src, int srcx, int srcy, const ImageRect& part);
+            //whole XImage_ or its cropped part from src at srcx, srcy
+            bool Grab(Drawable src, int srcx, int srcy);
+
         public:
             X11FrameProcessor();
             ~X11FrameProcessor();
@@ -12,16 +12,37 @@ namespace SL
         class X11MouseProcessor: public BaseFrameProcessor
         {
             Display* SelectedDisplay = nullptr;
-            std::unique_ptr<unsigned char[]> OldImageBuffer;
             XID RootWindow;
-            int Last_x = 0;
-            int Last_y = 0;
+            //position is reported relative to this window, root for monitors capture
+            XID RelativeToWindow;
+            bool WindowMode = false;
 
+            //cursor image is fetched only when XFixes notifies about change, -1 if extension is not available (fetching each time)
+            int CursorEventBase = -1;
+            bool CursorChanged = true;
+            unsigned long LastSerial = 0;
+            Point LastHotSpot{0, 0};
+
+            int Last_x = -1;
+            int Last_y = -1;
+
+            //pointer position is queried only after XInput2 raw motion (or window move in window mode),
+            //thread sleeps on display connection meanwhile; -1 if XInput2 is not available (querying each time)
+            int XiOpcode = -1;
+            bool PointerMoved = true;
+            //longest sleep without events, capture stop waits for it
+            const int MaxEventWaitMs = 100;
+
+            void SelectRawMotion();
+
+            const MouseCallback& callback() const;
+            const Image* FetchCursorImage(Image& dst);
         public:
             const int MaxCursurorSize = 32;
             X11MouseProcessor();
             ~X11MouseProcessor();
             DUPL_RETURN Init(std::shared_ptr<Thread_Data> data);
+            DUPL_RETURN Init(std::shared_ptr<Thread_Data> data, const Window& window);
             DUPL_RETURN ProcessFrame();
 
         };
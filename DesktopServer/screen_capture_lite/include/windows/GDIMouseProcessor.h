@@ -15,6 +15,8 @@ namespace SL {
             std::unique_ptr<unsigned char[]> NewImageBuffer;
             int Last_x = 0;
             int Last_y = 0;
+            // MousePoint::Serial, changes with cursor image
+            unsigned long ShapeSerial = 0;
 
         public:
 
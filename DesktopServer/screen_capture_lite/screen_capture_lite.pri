@@ -16,13 +16,14 @@ SOURCES += $$PWD/src/ThreadManager.cpp
 unix:!macx {
        HEADERS += $$PWD/include/linux/X11MouseProcessor.h
        HEADERS += $$PWD/include/linux/X11FrameProcessor.h
+       HEADERS += $$PWD/include/linux/X11Errors.h
 
        SOURCES += $$PWD/src/linux/X11MouseProcessor.cpp
        SOURCES += $$PWD/src/linux/X11FrameProcessor.cpp
        SOURCES += $$PWD/src/linux/GetMonitors.cpp
        SOURCES += $$PWD/src/linux/GetWindows.cpp
        SOURCES += $$PWD/src/linux/ThreadRunner.cpp
-       LIBS += -lX11 -lXext -lXfixes -lXtst -lXinerama
+       LIBS += -lX11 -lXext -lXfixes -lXtst -lXinerama -lXcomposite -lXi
 
        #WARNING! set platform dependent include for each platform
        INCLUDEPATH += $$PWD/include/linux
@@ -320,6 +320,14 @@ namespace SL
         {
             return Width(img.Bounds);
         }
+        int OffsetX(const Image &img)
+        {
+            return img.Bounds.left;
+        }
+        int OffsetY(const Image &img)
+        {
+            return img.Bounds.top;
+        }
         int X(const Point &p)
         {
             return p.x;
@@ -341,6 +349,10 @@ namespace SL
         {
             return img.isContiguous;
         }
+        bool isChanged(const Image &img)
+        {
+            return img.isChanged;
+        }
         // number of bytes per row, NOT including the Rowpadding
         int RowStride(const Image &img)
         {
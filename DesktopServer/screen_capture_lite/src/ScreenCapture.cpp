@@ -59,6 +59,8 @@ namespace SL
                 ScreenCaptureManagerExists = true;
                 Thread_Data_ = std::make_shared<Thread_Data>();
                 Thread_Data_->CommonData_.Paused = false;
+                Thread_Data_->CommonData_.MaxIdleBackoff = 1;
+                Thread_Data_->CommonData_.ActivityCounter = 0;
                 Thread_Data_->ScreenCaptureData.FrameTimer = std::make_shared<Timer>(100ms);
                 Thread_Data_->ScreenCaptureData.MouseTimer = std::make_shared<Timer>(50ms);
                 Thread_Data_->WindowCaptureData.FrameTimer = std::make_shared<Timer>(100ms);
@@ -109,6 +111,22 @@ namespace SL
                 std::atomic_store(&Thread_Data_->ScreenCaptureData.MouseTimer, timer);
                 std::atomic_store(&Thread_Data_->WindowCaptureData.MouseTimer, timer);
             }
+            virtual void setIdleBackoff(int max_multiplier) override
+            {
+                Thread_Data_->CommonData_.MaxIdleBackoff = std::max(1, max_multiplier);
+            }
+            virtual void notifyActivity() override { ++Thread_Data_->CommonData_.ActivityCounter; }
+            virtual void setCropRegion(const Point &position, const Point &size, int full_every) override
+            {
+                std::shared_ptr<CropRegion> crop;
+                if (size.x > 0 && size.y > 0)
+                {
+                    crop = std::make_shared<CropRegion>();
+                    crop->Rect = ImageRect(position.x, position.y, position.x + size.x, position.y + size.y);
+                    crop->FullEvery = std::max(1, full_every);
+                }
+                std::atomic_store(&Thread_Data_->CommonData_.Crop, crop);
+            }
             virtual void pause() override
             {
                 Thread_Data_->CommonData_.Paused = true;
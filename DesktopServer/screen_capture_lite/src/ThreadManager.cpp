@@ -38,14 +38,16 @@ void SL::Screen_Capture::ThreadManager::Init(const std::shared_ptr<Thread_Data>&
         if (data->WindowCaptureData.getThingsToWatch)
         {
             auto windows = data->WindowCaptureData.getThingsToWatch();
-            m_ThreadHandles.resize(windows.size() + (data->WindowCaptureData.OnMouseChanged ? 1 : 0)); // add another thread for mouse capturing if needed
+            const bool with_mouse = data->WindowCaptureData.OnMouseChanged && !windows.empty();
+            m_ThreadHandles.resize(windows.size() + (with_mouse ? 1 : 0)); // add another thread for mouse capturing if needed
             for (size_t i = 0; i < windows.size(); ++i)
                 m_ThreadHandles[i] = std::thread(&SL::Screen_Capture::RunCaptureWindow, data, windows[i]);
-            if (data->WindowCaptureData.OnMouseChanged)
+            if (with_mouse)
             {
-                m_ThreadHandles.back() = std::thread([data]
+                //position is reported relative to the 1st window
+                m_ThreadHandles.back() = std::thread([data, window = windows.front()]
                 {
-                    SL::Screen_Capture::RunCaptureMouse(data);
+                    SL::Screen_Capture::RunCaptureMouse(data, window);
                 });
             }
         }
@@ -62,10 +62,12 @@ namespace Screen_Capture {
             MousePoint mousepoint = {};
             mousepoint.Position = Point{lastx, lasty};
             mousepoint.HotSpot = Point{imageRef.HotSpotx, imageRef.HotSpoty};
+            mousepoint.Serial = ShapeSerial;
 
             // if the mouse image is different, send the new image and swap the data
 
             if (memcmp(ImageBuffer.get(), OldImageBuffer.get(), datalen) != 0) {
+                mousepoint.Serial = ++ShapeSerial;
                 if (Data->ScreenCaptureData.OnMouseChanged) {
                     Data->ScreenCaptureData.OnMouseChanged(&wholeimgfirst, mousepoint);
                 }
@@ -9,6 +9,10 @@ namespace SL{
         void RunCaptureMouse(std::shared_ptr<Thread_Data> data) {
             TryCaptureMouse<NSMouseProcessor>(data);
         }
+        // NS mouse processor reports screen positions, window is not used
+        void RunCaptureMouse(std::shared_ptr<Thread_Data> data, Window) {
+            RunCaptureMouse(data);
+        }
         void RunCaptureMonitor(std::shared_ptr<Thread_Data> data, Monitor monitor){
             TryCaptureMonitor<NSFrameProcessor>(data, monitor);
         }
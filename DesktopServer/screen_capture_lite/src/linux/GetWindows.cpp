@@ -1,10 +1,16 @@
 #include "ScreenCapture.h"
 #include "internal/SCCommon.h"
+#include "X11Errors.h"
 #include <X11/Xlib.h>
 #include <X11/Xutil.h>
 #include <X11/Xatom.h>
+#include <poll.h>
 #include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 #include <iostream>
 
@@ -90,24 +96,249 @@ namespace SL
     namespace Screen_Capture
     {
 
-        void AddWindow(Display* display, XID& window, std::vector<Window>& wnd)
+        //false if window is gone already
+        bool AddWindow(Display* display, XID& window, std::vector<Window>& wnd)
         {
             using namespace std::string_literals;
 
+            X11ErrorTrap trap(display);
+            XWindowAttributes wndattr;
+            if (!XGetWindowAttributes(display, window, &wndattr))
+                return false;
+
             auto wm_name{UniqueTextProperty::GetWMName(display, window)};
             auto candidates = wm_name.TextPropertyToStrings(display);
             Window w = {};
             w.Handle = reinterpret_cast<size_t>(window);
 
-            XWindowAttributes wndattr;
-            XGetWindowAttributes(display, window, &wndattr);
-
             w.Position = Point{ wndattr.x, wndattr.y };
             w.Size = Point{ wndattr.width, wndattr.height };
 
             w.Name = (candidates.empty()) ? "" : std::move(candidates.front());
             std::transform(w.Name.begin(), w.Name.end(), w.Name.begin(), ::tolower);
             wnd.push_back(w);
+            return true;
+        }
+
+        namespace
+        {
+            std::vector<XID> ReadClientList(Display* display, Atom client_list)
+            {
+                Atom actualType;
+                int format;
+                unsigned long numItems = 0, bytesAfter = 0;
+                unsigned char* data = 0;
+                std::vector<XID> ret;
+                if (XGetWindowProperty(display, XDefaultRootWindow(display), client_list, 0L, (~0L), false, XA_WINDOW,
+                                       &actualType, &format, &numItems, &bytesAfter, &data) == Success && data)
+                {
+                    auto array = reinterpret_cast<::Window*>(data);
+                    ret.assign(array, array + numItems);
+                    XFree(data);
+                }
+                return ret;
+            }
+
+            //Keeps top level windows of the window manager (_NET_CLIENT_LIST) with lower-cased names.
+            //It is filled once, then own thread updates it from PropertyNotify/ConfigureNotify events,
+            //so lookups do not touch X server at all.
+            class X11WindowRegistry
+            {
+            public:
+                X11WindowRegistry(const X11WindowRegistry&) = delete;
+                X11WindowRegistry& operator=(const X11WindowRegistry&) = delete;
+
+                static X11WindowRegistry& instance()
+                {
+                    static X11WindowRegistry registry;
+                    return registry;
+                }
+
+                std::vector<Window> find(const std::string& name_part, size_t max_count)
+                {
+                    std::vector<Window> ret;
+                    std::lock_guard<std::mutex> lck(lock);
+
+                    //repeated searches (i.e. capture restarts) are O(1) until something changed,
+                    //all matches are cached, so any max_count is served by the same entry
+                    auto cached = search_cache.find(name_part);
+                    if (cached == search_cache.end())
+                    {
+                        std::vector<XID> found;
+                        if (!name_part.empty())
+                        {
+                            auto exact = by_name.equal_range(name_part);
+                            for (auto it = exact.first; it != exact.second; ++it)
+                                found.push_back(it->second);
+                        }
+                        //then substrings in client list order as GetWindows() did
+                        for (const auto id : order)
+                        {
+                            const auto w = windows.find(id);
+                            const bool exact = !name_part.empty() && w != windows.end() && w->second.Name == name_part;
+                            if (w != windows.end() && !exact && w->second.Name.find(name_part) != std::string::npos)
+                                found.push_back(id);
+                        }
+                        cached = search_cache.emplace(name_part, std::move(found)).first;
+                    }
+
+                    for (const auto id : cached->second)
+                    {
+                        if (ret.size() >= max_count)
+                            break;
+                        const auto w = windows.find(id);
+                        if (w != windows.end())
+                            ret.push_back(w->second);
+                    }
+                    return ret;
+                }
+
+                ~X11WindowRegistry()
+                {
+                    should_stop = true;
+                    if (thread.joinable())
+                        thread.join();
+                    if (display)
+                        XCloseDisplay(display);
+                }
+
+            private:
+                Display* display{nullptr};
+                Atom client_list{None};
+                Atom net_wm_name{None};
+                std::atomic<bool> should_stop{false};
+                std::thread thread;
+
+                std::mutex lock;
+                std::vector<XID> order;
+                std::unordered_map<XID, Window> windows;
+                std::unordered_multimap<std::string, XID> by_name;
+                std::unordered_map<std::string, std::vector<XID>> search_cache;
+
+                X11WindowRegistry()
+                {
+                    display = XOpenDisplay(NULL);
+                    if (!display)
+                        return;
+                    client_list = XInternAtom(display, "_NET_CLIENT_LIST", false);
+                    net_wm_name = XInternAtom(display, "_NET_WM_NAME", false);
+                    XSelectInput(display, XDefaultRootWindow(display), PropertyChangeMask);
+                    updateClientList();
+                    thread = std::thread([this]()
+                    {
+                        run();
+                    });
+                }
+
+                void run()
+                {
+                    pollfd pfd{ConnectionNumber(display), POLLIN, 0};
+                    while (!should_stop)
+                    {
+                        if (!XPending(display))
+                        {
+                            poll(&pfd, 1, 250);
+                            continue;
+                        }
+                        XEvent ev;
+                        XNextEvent(display, &ev);
+                        switch (ev.type)
+                        {
+                            case PropertyNotify:
+                                if (ev.xproperty.window == XDefaultRootWindow(display))
+                                {
+                                    if (ev.xproperty.atom == client_list)
+                                        updateClientList();
+                                }
+                                else if (ev.xproperty.atom == XA_WM_NAME || ev.xproperty.atom == net_wm_name)
+                                    updateWindow(ev.xproperty.window);
+                                break;
+                            case ConfigureNotify:
+                            {
+                                std::lock_guard<std::mutex> lck(lock);
+                                auto it = windows.find(ev.xconfigure.window);
+                                if (it != windows.end())
+                                {
+                                    it->second.Position = Point{ ev.xconfigure.x, ev.xconfigure.y };
+                                    it->second.Size = Point{ ev.xconfigure.width, ev.xconfigure.height };
+                                }
+                            }
+                            break;
+                            case DestroyNotify:
+                            {
+                                std::lock_guard<std::mutex> lck(lock);
+                                removeLocked(ev.xdestroywindow.window);
+                            }
+                            break;
+                            default:
+                                break;
+                        }
+                    }
+                }
+
+                void updateClientList()
+                {
+                    auto list = ReadClientList(display, client_list);
+                    std::vector<XID> added;
+                    {
+                        std::lock_guard<std::mutex> lck(lock);
+                        for (const auto id : list)
+                            if (!windows.count(id))
+                                added.push_back(id);
+                        for (const auto id : order)
+                            if (std::find(list.begin(), list.end(), id) == list.end())
+                                removeLocked(id);
+                        order = list;
+                        search_cache.clear();
+                    }
+                    for (auto id : added)
+                    {
+                        //window may be gone already
+                        X11ErrorTrap trap(display);
+                        XSelectInput(display, id, PropertyChangeMask | StructureNotifyMask);
+                        updateWindow(id);
+                    }
+                }
+
+                void updateWindow(XID id)
+                {
+                    std::vector<Window> tmp;
+                    const bool alive = AddWindow(display, id, tmp);
+
+                    std::lock_guard<std::mutex> lck(lock);
+                    if (std::find(order.begin(), order.end(), id) == order.end())
+                        return;
+                    removeLocked(id);
+                    //destroyed before we looked at it, DestroyNotify may never come as input was not selected yet
+                    if (!alive)
+                        return;
+                    by_name.emplace(tmp.front().Name, id);
+                    windows[id] = std::move(tmp.front());
+                }
+
+                void removeLocked(XID id)
+                {
+                    auto it = windows.find(id);
+                    if (it == windows.end())
+                        return;
+                    auto range = by_name.equal_range(it->second.Name);
+                    for (auto n = range.first; n != range.second; ++n)
+                        if (n->second == id)
+                        {
+                            by_name.erase(n);
+                            break;
+                        }
+                    windows.erase(it);
+                    search_cache.clear();
+                }
+            };
+        }
+
+        std::vector<Window> FindWindows(const std::string &name_part, size_t max_count)
+        {
+            std::string srch(name_part);
+            std::transform(srch.begin(), srch.end(), srch.begin(), ::tolower);
+            return X11WindowRegistry::instance().find(srch, max_count);
         }
 
         std::vector<Window> GetWindows()
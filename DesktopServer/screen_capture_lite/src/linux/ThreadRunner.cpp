@@ -11,6 +11,10 @@ namespace SL
         {
             TryCaptureMouse<X11MouseProcessor>(data);
         }
+        void RunCaptureMouse(std::shared_ptr<Thread_Data> data, Window window)
+        {
+            TryCaptureMouse<X11MouseProcessor>(data, window);
+        }
         void RunCaptureMonitor(std::shared_ptr<Thread_Data> data, Monitor monitor)
         {
             TryCaptureMonitor<X11FrameProcessor>(data, monitor);
@@ -1,6 +1,9 @@
 #include "X11FrameProcessor.h"
+#include "X11Errors.h"
 #include <X11/Xutil.h>
 #include <assert.h>
+#include <algorithm>
+#include <cstring>
 #include <vector>
 
 namespace SL
@@ -13,17 +16,250 @@ namespace SL
 
         X11FrameProcessor::~X11FrameProcessor()
         {
+            {
+                //window may be destroyed already, trap must end before display is closed
+                X11ErrorTrap trap(SelectedDisplay);
+                if (CompositePixmap)
+                    XFreePixmap(SelectedDisplay, CompositePixmap);
+                if (CompositeRedirected)
+                    XCompositeUnredirectWindow(SelectedDisplay, SelectedWindow, CompositeRedirectAutomatic);
+            }
+            FreeShmSegment();
+            if (CropImage_)
+            {
+                CropImage_->data = nullptr;
+                XDestroyImage(CropImage_);
+            }
+            if (XImage_)
+                XDestroyImage(XImage_);
+            if (SelectedDisplay)
+                XCloseDisplay(SelectedDisplay);
+        }
 
-            if (ShmInfo)
+        void X11FrameProcessor::FreeShmSegment()
+        {
+            if (ShmInfo && ShmSize)
             {
                 shmdt(ShmInfo->shmaddr);
                 shmctl(ShmInfo->shmid, IPC_RMID, 0);
                 XShmDetach(SelectedDisplay, ShmInfo.get());
             }
+            ShmSize = 0;
+        }
+
+        bool X11FrameProcessor::CreateShmImage(int width, int height, size_t min_segment_size)
+        {
+            const int scr = XDefaultScreen(SelectedDisplay);
+
+            //XImage is only header here, data is our shared segment, so it is cheap to recreate it
             if (XImage_)
+            {
+                XImage_->data = nullptr;
                 XDestroyImage(XImage_);
-            if (SelectedDisplay)
-                XCloseDisplay(SelectedDisplay);
+                XImage_ = nullptr;
+            }
+
+            if (!ShmInfo)
+                ShmInfo = std::make_unique<XShmSegmentInfo>();
+
+            XImage_ = XShmCreateImage(SelectedDisplay,
+                                      DefaultVisual(SelectedDisplay, scr),
+                                      DefaultDepth(SelectedDisplay, scr),
+                                      ZPixmap,
+                                      NULL,
+                                      ShmInfo.get(),
+                                      width,
+                                      height);
+            if (!XImage_)
+                return false;
+
+            const size_t need = std::max(min_segment_size, static_cast<size_t>(XImage_->bytes_per_line * XImage_->height));
+            if (need > ShmSize)
+            {
+                //segment is too small (or not created yet) - the only case when we go to the kernel/X server
+                FreeShmSegment();
+                ShmInfo->shmid = shmget(IPC_PRIVATE, need, IPC_CREAT | 0777);
+                if (ShmInfo->shmid < 0)
+                    return false;
+                ShmInfo->readOnly = False;
+                ShmInfo->shmaddr = (char*)shmat(ShmInfo->shmid, 0, 0);
+                XShmAttach(SelectedDisplay, ShmInfo.get());
+                ShmSize = need;
+            }
+            XImage_->data = ShmInfo->shmaddr;
+            return true;
+        }
+
+        //true if this frame grabs crop region only, part is it clipped to the picture
+        bool X11FrameProcessor::UseCrop(ImageRect& part)
+        {
+            const auto crop = std::atomic_load(&Data->CommonData_.Crop);
+            if (!crop || FirstRun)
+            {
+                FramesSinceFull = 0;
+                return false;
+            }
+            part = ImageRect(std::max(0, crop->Rect.left), std::max(0, crop->Rect.top),
+                             std::min(XImage_->width, crop->Rect.right), std::min(XImage_->height, crop->Rect.bottom));
+            if (part.right <= part.left || part.bottom <= part.top || ++FramesSinceFull >= crop->FullEvery)
+            {
+                FramesSinceFull = 0;
+                return false;
+            }
+
+            //segment must fit both images, growing it loses XImage_ content, so this frame is grabbed whole then
+            const size_t main_size = static_cast<size_t>(XImage_->bytes_per_line) * XImage_->height;
+            const size_t need = main_size + static_cast<size_t>(Width(part)) * Height(part) * sizeof(ImageBGRA);
+            if (need > ShmSize)
+            {
+                CreateShmImage(XImage_->width, XImage_->height, need);
+                FramesSinceFull = 0;
+                return false;
+            }
+            return true;
+        }
+
+        bool X11FrameProcessor::GrabPart(Drawable src, int srcx, int srcy, const ImageRect& part)
+        {
+            const int w = Width(part);
+            const int h = Height(part);
+            if (!CropImage_ || CropImage_->width != w || CropImage_->height != h)
+            {
+                if (CropImage_)
+                {
+                    CropImage_->data = nullptr;
+                    XDestroyImage(CropImage_);
+                }
+                const int scr = XDefaultScreen(SelectedDisplay);
+                CropImage_ = XShmCreateImage(SelectedDisplay, DefaultVisual(SelectedDisplay, scr), DefaultDepth(SelectedDisplay, scr),
+                                             ZPixmap, NULL, ShmInfo.get(), w, h);
+                if (!CropImage_)
+                    return false;
+            }
+            const size_t main_size = static_cast<size_t>(XImage_->bytes_per_line) * XImage_->height;
+            if (main_size + static_cast<size_t>(CropImage_->bytes_per_line) * h > ShmSize)
+                return false;
+            CropImage_->data = ShmInfo->shmaddr + main_size;
+            if (!XShmGetImage(SelectedDisplay, src, CropImage_, srcx + part.left, srcy + part.top, AllPlanes))
+                return false;
+
+            const size_t line = static_cast<size_t>(w) * sizeof(ImageBGRA);
+            for (int j = 0; j < h; ++j)
+                memcpy(XImage_->data + static_cast<size_t>(part.top + j) * XImage_->bytes_per_line + part.left * sizeof(ImageBGRA),
+                       CropImage_->data + static_cast<size_t>(j) * CropImage_->bytes_per_line, line);
+            return true;
+        }
+
+        bool X11FrameProcessor::Grab(Drawable src, int srcx, int srcy)
+        {
+            ImageRect part;
+            if (UseCrop(part) && GrabPart(src, srcx, srcy, part))
+                return true;
+            return XShmGetImage(SelectedDisplay, src, XImage_, srcx, srcy, AllPlanes);
+        }
+
+        bool X11FrameProcessor::ResizeWindowImage(Window& selectedwindow, int width, int height)
+        {
+            if (!CreateShmImage(width, height))
+                return false;
+
+            Width(selectedwindow, width);
+            Height(selectedwindow, height);
+
+            //reference image for difs must follow, first frame after resize is sent as whole
+            const size_t newsize = static_cast<size_t>(width) * height * sizeof(ImageBGRA);
+            if (ImageBuffer && newsize > ImageBufferSize)
+            {
+                ImageBuffer = std::make_unique<unsigned char[]>(newsize);
+                ImageBufferSize = newsize;
+            }
+            FirstRun = true;
+            return true;
+        }
+
+        bool X11FrameProcessor::WatchWindow()
+        {
+            XWindowAttributes wndattr;
+            if (XGetWindowAttributes(SelectedDisplay, SelectedWindow, &wndattr) == 0)
+                return false;
+            XSelectInput(SelectedDisplay, SelectedWindow, StructureNotifyMask);
+            EventWidth = wndattr.width;
+            EventHeight = wndattr.height;
+            BorderWidth = wndattr.border_width;
+            WindowMapped = wndattr.map_state == IsViewable;
+            return true;
+        }
+
+        bool X11FrameProcessor::InitComposite()
+        {
+            int event_base = 0, error_base = 0, major = 0, minor = 0;
+            if (!XCompositeQueryExtension(SelectedDisplay, &event_base, &error_base))
+                return false;
+            //XCompositeNameWindowPixmap appeared in 0.2
+            if (!XCompositeQueryVersion(SelectedDisplay, &major, &minor) || (major == 0 && minor < 2))
+                return false;
+
+            XCompositeRedirectWindow(SelectedDisplay, SelectedWindow, CompositeRedirectAutomatic);
+            CompositeRedirected = true;
+            if (WindowMapped)
+                NameCompositePixmap();
+            return true;
+        }
+
+        void X11FrameProcessor::NameCompositePixmap()
+        {
+            //pixmap is bound to the window size at the moment of naming, so it must be renamed after each resize/map
+            if (CompositePixmap)
+                XFreePixmap(SelectedDisplay, CompositePixmap);
+            CompositePixmap = XCompositeNameWindowPixmap(SelectedDisplay, SelectedWindow);
+        }
+
+        DUPL_RETURN X11FrameProcessor::ProcessWindowEvents(Window& selectedwindow)
+        {
+            bool rename = false;
+            while (XPending(SelectedDisplay))
+            {
+                XEvent ev;
+                XNextEvent(SelectedDisplay, &ev);
+                switch (ev.type)
+                {
+                    case ConfigureNotify:
+                        if (ev.xconfigure.window == SelectedWindow)
+                        {
+                            EventWidth = ev.xconfigure.width;
+                            EventHeight = ev.xconfigure.height;
+                            //pixmap size follows the border too
+                            if (ev.xconfigure.border_width != BorderWidth)
+                            {
+                                BorderWidth = ev.xconfigure.border_width;
+                                rename = true;
+                            }
+                        }
+                        break;
+                    case MapNotify:
+                        WindowMapped = true;
+                        rename = true;
+                        break;
+                    case UnmapNotify:
+                        WindowMapped = false;
+                        break;
+                    case DestroyNotify:
+                        return DUPL_RETURN::DUPL_RETURN_ERROR_EXPECTED;//window is gone, let it find new one
+                    default:
+                        break;
+                }
+            }
+
+            if (EventWidth != Width(selectedwindow) || EventHeight != Height(selectedwindow))
+            {
+                if (!ResizeWindowImage(selectedwindow, EventWidth, EventHeight))
+                    return DUPL_RETURN::DUPL_RETURN_ERROR_EXPECTED;
+                rename = true;
+            }
+
+            if (rename && WindowMapped && CompositeRedirected)
+                NameCompositePixmap();
+            return DUPL_RETURN::DUPL_RETURN_SUCCESS;
         }
 
         DUPL_RETURN X11FrameProcessor::Init(std::shared_ptr<Thread_Data> data, const Window& selectedwindow)
@@ -35,24 +271,19 @@ namespace SL
             SelectedWindow = selectedwindow.Handle;
             if (!SelectedDisplay)
                 return DUPL_RETURN::DUPL_RETURN_ERROR_EXPECTED;
+            X11ErrorTrap trap(SelectedDisplay);
             int scr = XDefaultScreen(SelectedDisplay);
 
-            ShmInfo = std::make_unique<XShmSegmentInfo>();
-
-            XImage_ = XShmCreateImage(SelectedDisplay,
-                                      DefaultVisual(SelectedDisplay, scr),
-                                      DefaultDepth(SelectedDisplay, scr),
-                                      ZPixmap,
-                                      NULL,
-                                      ShmInfo.get(),
-                                      selectedwindow.Size.x,
-                                      selectedwindow.Size.y);
-            ShmInfo->shmid = shmget(IPC_PRIVATE, XImage_->bytes_per_line * XImage_->height, IPC_CREAT | 0777);
-
-            ShmInfo->readOnly = False;
-            ShmInfo->shmaddr = XImage_->data = (char*)shmat(ShmInfo->shmid, 0, 0);
+            //segment is over-allocated to the screen size, so window resizes just recreate XImage header
+            const size_t screen_size = static_cast<size_t>(DisplayWidth(SelectedDisplay, scr)) * DisplayHeight(SelectedDisplay, scr) * sizeof(ImageBGRA);
+            if (!CreateShmImage(selectedwindow.Size.x, selectedwindow.Size.y, screen_size))
+                return DUPL_RETURN::DUPL_RETURN_ERROR_EXPECTED;
 
-            XShmAttach(SelectedDisplay, ShmInfo.get());
+            if (!WatchWindow())
+                return DUPL_RETURN::DUPL_RETURN_ERROR_EXPECTED;
+            //if composite is not supported by X server we will grab window itself as before,
+            //it must stay on top to be captured then
+            InitComposite();
 
             return ret;
         }
@@ -64,24 +295,9 @@ namespace SL
             SelectedDisplay = XOpenDisplay(NULL);
             if (!SelectedDisplay)
                 return DUPL_RETURN::DUPL_RETURN_ERROR_EXPECTED;
-            int scr = XDefaultScreen(SelectedDisplay);
-
-            ShmInfo = std::make_unique<XShmSegmentInfo>();
-
-            XImage_ = XShmCreateImage(SelectedDisplay,
-                                      DefaultVisual(SelectedDisplay, scr),
-                                      DefaultDepth(SelectedDisplay, scr),
-                                      ZPixmap,
-                                      NULL,
-                                      ShmInfo.get(),
-                                      Width(SelectedMonitor),
-                                      Height(SelectedMonitor));
-            ShmInfo->shmid = shmget(IPC_PRIVATE, XImage_->bytes_per_line * XImage_->height, IPC_CREAT | 0777);
 
-            ShmInfo->readOnly = False;
-            ShmInfo->shmaddr = XImage_->data = (char*)shmat(ShmInfo->shmid, 0, 0);
-
-            XShmAttach(SelectedDisplay, ShmInfo.get());
+            if (!CreateShmImage(Width(SelectedMonitor), Height(SelectedMonitor)))
+                return DUPL_RETURN::DUPL_RETURN_ERROR_EXPECTED;
 
             return ret;
         }
@@ -90,35 +306,25 @@ namespace SL
         {
 
             auto Ret = DUPL_RETURN_SUCCESS;
-            if (!XShmGetImage(SelectedDisplay,
-                              RootWindow(SelectedDisplay, DefaultScreen(SelectedDisplay)),
-                              XImage_,
-                              OffsetX(SelectedMonitor),
-                              OffsetY(SelectedMonitor),
-                              AllPlanes))
+            if (!Grab(RootWindow(SelectedDisplay, DefaultScreen(SelectedDisplay)), OffsetX(SelectedMonitor), OffsetY(SelectedMonitor)))
                 return DUPL_RETURN_ERROR_EXPECTED;
             ProcessCapture(Data->ScreenCaptureData, *this, SelectedMonitor, (unsigned char*)XImage_->data, XImage_->bytes_per_line);
             return Ret;
         }
         DUPL_RETURN X11FrameProcessor::ProcessFrame(Window& selectedwindow)
         {
+            X11ErrorTrap trap(SelectedDisplay);
+            auto Ret = ProcessWindowEvents(selectedwindow);
+            if (Ret != DUPL_RETURN_SUCCESS)
+                return Ret;
 
-            auto Ret = DUPL_RETURN_SUCCESS;
-            XWindowAttributes wndattr;
-            if (XGetWindowAttributes(SelectedDisplay, SelectedWindow, &wndattr) == 0)
-            {
-                return DUPL_RETURN::DUPL_RETURN_ERROR_EXPECTED;//window might not be valid any more
-            }
-            if (wndattr.width != Width(selectedwindow) || wndattr.height != Height(selectedwindow))
-            {
-                return DUPL_RETURN::DUPL_RETURN_ERROR_EXPECTED;//window size changed. This will rebuild everything
-            }
-            if (!XShmGetImage(SelectedDisplay,
-                              selectedwindow.Handle,
-                              XImage_,
-                              0,
-                              0,
-                              AllPlanes))
+            //minimized window has no content, client keeps last frame
+            if (!WindowMapped || (CompositeRedirected && !CompositePixmap))
+                return Ret;
+            //composite pixmap includes the border
+            const Drawable src = (CompositeRedirected) ? CompositePixmap : static_cast<Drawable>(selectedwindow.Handle);
+            const int border = (CompositeRedirected) ? BorderWidth : 0;
+            if (!Grab(src, border, border))
                 return DUPL_RETURN_ERROR_EXPECTED;
             ProcessCapture(Data->WindowCaptureData, *this, selectedwindow, (unsigned char*)XImage_->data, XImage_->bytes_per_line);
             return Ret;
@@ -1,7 +1,11 @@
 #include "X11MouseProcessor.h"
+#include "X11Errors.h"
 
+#include <X11/extensions/XInput2.h>
+#include <poll.h>
 #include <assert.h>
 #include <cstring>
+#include <cstdint>
 
 namespace SL
 {
@@ -28,65 +32,151 @@ namespace SL
             RootWindow = DefaultRootWindow(SelectedDisplay);
             if (!RootWindow)
                 return DUPL_RETURN::DUPL_RETURN_ERROR_EXPECTED;
+            RelativeToWindow = RootWindow;
+
+            int error_base = 0;
+            if (XFixesQueryExtension(SelectedDisplay, &CursorEventBase, &error_base))
+                XFixesSelectCursorInput(SelectedDisplay, RootWindow, XFixesDisplayCursorNotifyMask);
+            else
+                CursorEventBase = -1;
+            //cursor image events come anyway, so without XFixes waiting for events makes no sense
+            if (CursorEventBase >= 0)
+                SelectRawMotion();
             return ret;
         }
+
+        void X11MouseProcessor::SelectRawMotion()
+        {
+            int event_base = 0, error_base = 0;
+            int major = 2, minor = 0;
+            if (!XQueryExtension(SelectedDisplay, "XInputExtension", &XiOpcode, &event_base, &error_base) ||
+                    XIQueryVersion(SelectedDisplay, &major, &minor) != Success)
+            {
+                XiOpcode = -1;
+                return;
+            }
+            //raw events of root window come wherever pointer is, core MotionNotify would not
+            unsigned char bits[XIMaskLen(XI_RawMotion)] = {};
+            XISetMask(bits, XI_RawMotion);
+            XIEventMask mask{XIAllMasterDevices, static_cast<int>(sizeof(bits)), bits};
+            XISelectEvents(SelectedDisplay, RootWindow, &mask, 1);
+        }
+
+        DUPL_RETURN X11MouseProcessor::Init(std::shared_ptr<Thread_Data> data, const Window& window)
+        {
+            auto ret = Init(data);
+            if (ret == DUPL_RETURN::DUPL_RETURN_SUCCESS)
+            {
+                RelativeToWindow = static_cast<XID>(window.Handle);
+                WindowMode = true;
+                //window moving under still pointer changes position too
+                if (XiOpcode >= 0)
+                {
+                    X11ErrorTrap trap(SelectedDisplay);
+                    XSelectInput(SelectedDisplay, RelativeToWindow, StructureNotifyMask);
+                }
+            }
+            return ret;
+        }
+
+        const MouseCallback& X11MouseProcessor::callback() const
+        {
+            return (WindowMode) ? Data->WindowCaptureData.OnMouseChanged : Data->ScreenCaptureData.OnMouseChanged;
+        }
+
+        const Image* X11MouseProcessor::FetchCursorImage(Image& dst)
+        {
+            auto img = XFixesGetCursorImage(SelectedDisplay);
+            if (!img)
+                return nullptr;
+            CursorChanged = CursorEventBase < 0;
+
+            const Image* res = nullptr;
+            if (img->cursor_serial != LastSerial)
+            {
+                ImageRect imgrect;
+                imgrect.left = imgrect.top = 0;
+                imgrect.right = img->width;
+                imgrect.bottom = img->height;
+                const size_t count = static_cast<size_t>(img->width) * img->height;
+                const size_t newsize = sizeof(ImageBGRA) * count;
+                if (newsize > ImageBufferSize || !ImageBuffer)
+                {
+                    ImageBuffer = std::make_unique<unsigned char[]>(newsize);
+                    ImageBufferSize = newsize;
+                }
+
+                //pixels are ARGB stored in longs, which can be 64 bits
+                auto pixels = reinterpret_cast<uint32_t*>(ImageBuffer.get());
+                for (size_t i = 0; i < count; ++i)
+                    pixels[i] = static_cast<uint32_t>(img->pixels[i]);
+
+                LastSerial = img->cursor_serial;
+                LastHotSpot = Point{static_cast<int>(img->xhot), static_cast<int>(img->yhot)};
+                dst = CreateImage(imgrect, 0, reinterpret_cast<const ImageBGRA*>(ImageBuffer.get()));
+                dst.isContiguous = true;
+                res = &dst;
+            }
+            XFree(img);
+            return res;
+        }
         //
         // Process a given frame and its metadata
         //
         DUPL_RETURN X11MouseProcessor::ProcessFrame()
         {
             auto Ret = DUPL_RETURN_SUCCESS;
+            //window pointer is reported relative to may be destroyed
+            X11ErrorTrap trap(SelectedDisplay);
 
-            auto img = XFixesGetCursorImage(SelectedDisplay);
-
-            if (sizeof(img->pixels[0]) == 8)  //if the pixelstride is 64 bits.. scale down to 32bits
+            //nothing happened since last call, sleeping until pointer moves or cursor changes
+            if (XiOpcode >= 0 && !PointerMoved && !CursorChanged && !XPending(SelectedDisplay))
             {
-                auto pixels = (int *)img->pixels;
-                for (auto i = 0; i < img->width * img->height; ++i)
-                    pixels[i] = pixels[i * 2];
+                pollfd pfd{ConnectionNumber(SelectedDisplay), POLLIN, 0};
+                poll(&pfd, 1, MaxEventWaitMs);
             }
-            ImageRect imgrect;
-            imgrect.left = imgrect.top = 0;
-            imgrect.right = img->width;
-            imgrect.bottom = img->height;
-            auto newsize = sizeof(ImageBGRA) * imgrect.right * imgrect.bottom;
-            if (newsize > ImageBufferSize || !OldImageBuffer)
+
+            while (XPending(SelectedDisplay))
             {
-                ImageBuffer = std::make_unique<unsigned char[]>(sizeof(ImageBGRA) * imgrect.right * imgrect.bottom);
-                OldImageBuffer = std::make_unique<unsigned char[]>(sizeof(ImageBGRA) * imgrect.right * imgrect.bottom);
+                XEvent ev;
+                XNextEvent(SelectedDisplay, &ev);
+                if (CursorEventBase >= 0 && ev.type == CursorEventBase + XFixesCursorNotify)
+                {
+                    const auto cev = reinterpret_cast<const XFixesCursorNotifyEvent*>(&ev);
+                    CursorChanged = CursorChanged || cev->cursor_serial != LastSerial;
+                }
+                else if (ev.type == GenericEvent && ev.xcookie.extension == XiOpcode)
+                    PointerMoved = true;
+                else if (ev.type == ConfigureNotify)
+                    PointerMoved = true;
             }
 
-            memcpy(ImageBuffer.get(), img->pixels, newsize);
+            Image wholeimg;
+            const Image* changed = (CursorChanged) ? FetchCursorImage(wholeimg) : nullptr;
+            if (XiOpcode >= 0 && !PointerMoved && !changed)
+                return Ret;
+            PointerMoved = false;
 
-            // Get the mouse cursor position
-            int x, y, root_x, root_y = 0;
+            // Get the mouse cursor position, that is single cheap request unlike cursor image
+            int x = 0, y = 0, root_x = 0, root_y = 0;
             unsigned int mask = 0;
             XID child_win, root_win;
-            XQueryPointer(SelectedDisplay, RootWindow, &child_win, &root_win, &root_x, &root_y, &x, &y, &mask);
-
-            XFree(img);
+            if (!XQueryPointer(SelectedDisplay, RelativeToWindow, &child_win, &root_win, &root_x, &root_y, &x, &y, &mask) && !changed)
+                return Ret;//pointer is on other screen
 
-            MousePoint mousepoint = {};
-            mousepoint.Position = Point{x, y};
-            mousepoint.HotSpot = Point{static_cast<int>(img->xhot), static_cast<int>(img->yhot)};
-
-            if (Data->ScreenCaptureData.OnMouseChanged)
+            const auto& cb = callback();
+            if (changed || Last_x != x || Last_y != y)
+                ++Data->CommonData_.ActivityCounter; //frames capture goes back to full rate
+            if (cb && (changed || Last_x != x || Last_y != y))
             {
-
-                auto wholeimg = CreateImage(imgrect, 0, reinterpret_cast<const ImageBGRA*>(OldImageBuffer.get()));
-
-                //if the mouse image is different, send the new image and swap the data
-                if (memcmp(ImageBuffer.get(), OldImageBuffer.get(), newsize) != 0)
-                {
-                    Data->ScreenCaptureData.OnMouseChanged(&wholeimg, mousepoint);
-                    std::swap(ImageBuffer, OldImageBuffer);
-                }
-                else
-                    if (Last_x != x || Last_y != y)
-                        Data->ScreenCaptureData.OnMouseChanged(nullptr, mousepoint);
-                Last_x = x;
-                Last_y = y;
+                MousePoint mousepoint = {};
+                mousepoint.Position = Point{x, y};
+                mousepoint.HotSpot = LastHotSpot;
+                mousepoint.Serial = LastSerial;
+                cb(changed, mousepoint);
             }
+            Last_x = x;
+            Last_y = y;
             return Ret;
         }
 
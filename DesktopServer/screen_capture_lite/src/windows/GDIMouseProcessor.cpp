@@ -92,10 +92,12 @@ namespace Screen_Capture {
         MousePoint mousepoint = {};
         mousepoint.Position = Point{lastx, lasty};
         mousepoint.HotSpot = Point{static_cast<int>(ii.xHotspot), static_cast<int>(ii.yHotspot)};
+        mousepoint.Serial = ShapeSerial;
 
         if (Data->ScreenCaptureData.OnMouseChanged || Data->WindowCaptureData.OnMouseChanged) {
             // if the mouse image is different, send the new image and swap the data
             if (memcmp(NewImageBuffer.get(), ImageBuffer.get(), bi.biSizeImage) != 0) {
+                mousepoint.Serial = ++ShapeSerial;
                 if (Data->WindowCaptureData.OnMouseChanged) {
                     Data->WindowCaptureData.OnMouseChanged(&wholeimg, mousepoint);
                 }
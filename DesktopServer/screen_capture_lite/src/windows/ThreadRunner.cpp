@@ -56,6 +56,8 @@ namespace Screen_Capture {
             return;
         TryCaptureMouse<GDIMouseProcessor>(data);
     }
+    // GDI mouse processor reports screen positions, window is not used
+    void RunCaptureMouse(std::shared_ptr<Thread_Data> data, Window) { RunCaptureMouse(data); }
     void RunCaptureMonitor(std::shared_ptr<Thread_Data> data, Monitor monitor)
     {
         // need to switch to the input desktop for capturing...
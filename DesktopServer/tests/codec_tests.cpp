@@ -0,0 +1,653 @@
+//Round trips of frame_codec encoders through their decoders and encode timings of 1080p pictures.
+//Non zero exit code means some check failed, timings are printed only.
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <thread>
+#include "decoders.h"
+#include "frame_codec.h"
+#include "pixels.h"
+#include "video_region.h"
+
+namespace
+{
+    int failures = 0;
+
+#define CHECK(COND) do { if (!(COND)) { ++failures; std::cout << "FAILED " << __LINE__ << ": " << #COND << std::endl; } } while (0)
+
+    //desktop alike RGB888 picture: gradient background, flat windows, text like noise
+    std::vector<uint8_t> makePicture(int w, int h)
+    {
+        std::vector<uint8_t> rgb(static_cast<size_t>(w) * h * 3);
+        uint32_t seed = 12345;
+        for (int y = 0; y < h; ++y)
+            for (int x = 0; x < w; ++x)
+            {
+                auto p = rgb.data() + (static_cast<size_t>(y) * w + x) * 3;
+                const bool window = x > w / 8 && x < w / 2 && y > h / 8 && y < h * 3 / 4;
+                if (window && (y / 12) % 2 == 0)
+                {
+                    seed = seed * 1103515245u + 12345u;
+                    const uint8_t v = (seed >> 16) & 1 ? 20 : 235;
+                    p[0] = p[1] = p[2] = v;
+                }
+                else if (window)
+                {
+                    p[0] = 240;
+                    p[1] = 240;
+                    p[2] = 240;
+                }
+                else
+                {
+                    p[0] = static_cast<uint8_t>(x * 255 / w);
+                    p[1] = static_cast<uint8_t>(y * 255 / h);
+                    p[2] = 128;
+                }
+            }
+        return rgb;
+    }
+
+    double msPerRun(int runs, const std::function<void()>& f)
+    {
+        f();
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < runs; ++i)
+            f();
+        const std::chrono::duration<double, std::milli> d = std::chrono::steady_clock::now() - start;
+        return d.count() / runs;
+    }
+
+    //picture of exactly colors distinct colors (w * h >= colors), the rest repeats them in runs of 3,
+    //so the indexer's last color shortcut is taken too
+    std::vector<uint8_t> makeColors(int w, int h, int colors)
+    {
+        const auto count = static_cast<size_t>(w) * h;
+        const auto n = static_cast<size_t>(colors);
+        std::vector<uint8_t> rgb(count * 3);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const size_t c = (i < n) ? i : (i / 3 + i * i) % n;
+            rgb[i * 3] = static_cast<uint8_t>(c);
+            rgb[i * 3 + 1] = static_cast<uint8_t>((c >> 8) * 40);
+            rgb[i * 3 + 2] = 7;
+        }
+        return rgb;
+    }
+
+    void testPng()
+    {
+        struct Case
+        {
+            int w;
+            int h;
+            int colors;
+            bool palette;
+        };
+        //256 colors is the last palette picture, 300 x 300 palette spans several stored deflate blocks
+        const Case cases[] = {{1, 1, 1, true}, {17, 9, 2, true}, {64, 64, 256, true}, {64, 64, 257, false},
+            {300, 300, 200, true}, {300, 300, 1000, false}
+        };
+        for (const auto& c : cases)
+        {
+            const auto rgb = makeColors(c.w, c.h, c.colors);
+            std::vector<uint8_t> png{1, 2};
+            frame_codec::appendPng(rgb, c.w, c.h, png);
+            CHECK(png[0] == 1 && png[1] == 2);
+            png.erase(png.begin(), png.begin() + 2);
+            int w = 0;
+            int h = 0;
+            bool palette = false;
+            std::vector<uint8_t> decoded;
+            CHECK(decodePng(png, w, h, palette, decoded));
+            CHECK(w == c.w && h == c.h && palette == c.palette);
+            CHECK(decoded == rgb);
+        }
+    }
+
+    void testJpeg()
+    {
+        constexpr int W = 1920;
+        constexpr int H = 1080;
+        const auto rgb = makePicture(W, H);
+
+        for (int quality : {50, 75, 95})
+        {
+            std::vector<uint8_t> jpeg{0xAA};
+            frame_codec::appendJpeg(rgb.data(), W, H, quality, jpeg);
+            CHECK(jpeg.size() > 1 && jpeg[0] == 0xAA);
+            jpeg.erase(jpeg.begin());
+
+            int w = 0;
+            int h = 0;
+            std::vector<uint8_t> decoded;
+            CHECK(decodeJpeg(jpeg, w, h, decoded));
+            CHECK(w == W && h == H);
+            const double error = meanAbsError(rgb, decoded);
+            CHECK(error < ((quality < 75) ? 8. : 5.));
+            std::cout << "jpeg q" << quality << ": " << jpeg.size() << " bytes, mean error " << error << std::endl;
+        }
+
+        //odd sizes are padded by encoder, not by caller
+        const auto small = makePicture(13, 7);
+        std::vector<uint8_t> jpeg;
+        frame_codec::appendJpeg(small.data(), 13, 7, 90, jpeg);
+        int w = 0;
+        int h = 0;
+        std::vector<uint8_t> decoded;
+        CHECK(decodeJpeg(jpeg, w, h, decoded) && w == 13 && h == 7);
+
+        std::vector<uint8_t> out;
+        out.reserve(1 << 20);
+        const double ms = msPerRun(20, [&]()
+        {
+            out.clear();
+            frame_codec::appendJpeg(rgb.data(), W, H, 75, out);
+        });
+        std::cout << "jpeg 1920x1080 q75: " << ms << " ms" << std::endl;
+    }
+
+    bool qoiRoundTrip(const std::vector<uint8_t>& rgb, int w, int h)
+    {
+        std::vector<uint8_t> qoi{0x55};
+        frame_codec::appendQoi(rgb, w, h, qoi);
+        if (qoi[0] != 0x55)
+            return false;
+        int dw = 0;
+        int dh = 0;
+        std::vector<uint8_t> decoded;
+        return qoi::decode(qoi.data() + 1, qoi.size() - 1, decoded, dw, dh) && dw == w && dh == h && decoded == rgb;
+    }
+
+    void testQoi()
+    {
+        constexpr int W = 1920;
+        constexpr int H = 1080;
+        const auto rgb = makePicture(W, H);
+        CHECK(qoiRoundTrip(rgb, W, H));
+        CHECK(qoiRoundTrip(makePicture(1, 1), 1, 1));
+
+        //noise hits RGB and index ops, long flat line needs several runs (62 pixels max each)
+        std::vector<uint8_t> mixed(200 * 3 * 3);
+        uint32_t seed = 777;
+        for (size_t i = 0; i < mixed.size(); ++i)
+        {
+            seed = seed * 1103515245u + 12345u;
+            mixed[i] = (i >= 200 * 3 && i < 400 * 3) ? 7 : static_cast<uint8_t>((seed >> 16) & 0x0F);
+        }
+        CHECK(qoiRoundTrip(mixed, 200, 3));
+
+        std::vector<uint8_t> qoi;
+        frame_codec::appendQoi(rgb, W, H, qoi);
+        std::vector<uint8_t> decoded;
+        int w = 0;
+        int h = 0;
+        CHECK(!qoi::decode(qoi.data(), qoi.size() / 2, decoded, w, h));
+        CHECK(!qoi::decode(qoi.data() + 1, qoi.size() - 1, decoded, w, h));
+
+        //lossless tiles use QOI instead of PNG for these numbers
+        std::vector<uint8_t> png;
+        frame_codec::appendPng(rgb, W, H, png);
+        std::vector<uint8_t> out;
+        const double qoi_ms = msPerRun(10, [&]()
+        {
+            out.clear();
+            frame_codec::appendQoi(rgb, W, H, out);
+        });
+        const double png_ms = msPerRun(3, [&]()
+        {
+            out.clear();
+            frame_codec::appendPng(rgb, W, H, out);
+        });
+        const double decode_ms = msPerRun(10, [&]()
+        {
+            qoi::decode(qoi.data(), qoi.size(), decoded, w, h);
+        });
+        std::cout << "qoi 1920x1080: " << qoi_ms << " ms, " << qoi.size() << " bytes, decode " << decode_ms << " ms" << std::endl;
+        std::cout << "png 1920x1080: " << png_ms << " ms, " << png.size() << " bytes" << std::endl;
+    }
+
+    //conversion straight from capture buffer gives the same pixels as conversion to RGB888 and reduction after it
+    void testCaptureConversion()
+    {
+        constexpr size_t W = 37;
+        constexpr size_t H = 23;
+        constexpr size_t STRIDE = W * 4 + 12;
+        std::vector<uint8_t> bgrx(STRIDE * H);
+        uint32_t seed = 99;
+        for (auto& b : bgrx)
+        {
+            seed = seed * 1103515245u + 12345u;
+            b = static_cast<uint8_t>(seed >> 16);
+        }
+        std::vector<uint8_t> rgb(W * H * 3);
+        for (size_t j = 0; j < H; ++j)
+            for (size_t i = 0; i < W; ++i)
+                for (size_t c = 0; c < 3; ++c)
+                    rgb[(j * W + i) * 3 + c] = bgrx[j * STRIDE + i * 4 + 2 - c];
+
+        const frame_codec::Rect area{5, 3, 29, 17};
+        for (size_t scale : {1u, 2u, 3u, 4u})
+        {
+            std::vector<uint8_t> expected;
+            pixel_format::shrinkRGB888(rgb.data() + (area.y * W + area.x) * 3, W, area.w, area.h, scale, expected);
+            const size_t nw = (area.w + scale - 1) / scale;
+            const size_t nh = (area.h + scale - 1) / scale;
+            std::vector<uint8_t> converted(nw * nh * 3);
+            pixel_format::shrinkBGRX8888<false>(bgrx.data(), STRIDE, area.x, area.y, area.w, area.h, scale, scale,
+                                                converted.data(), nw * 3);
+            CHECK(converted == expected);
+
+            std::vector<uint8_t> passthrough(nw * nh * 4);
+            pixel_format::shrinkBGRX8888<true>(bgrx.data(), STRIDE, area.x, area.y, area.w, area.h, scale, scale,
+                                               passthrough.data(), nw * 4);
+            bool same = true;
+            for (size_t i = 0; i < nw * nh; ++i)
+                for (size_t c = 0; c < 3; ++c)
+                    same = same && passthrough[i * 4 + c] == expected[i * 3 + 2 - c];
+            CHECK(same);
+        }
+    }
+
+    //plain per pixel formulas the SSE2 converters must agree with
+    std::vector<uint8_t> scalarRaw(pixel_format::RawFormat format, const std::vector<uint8_t>& rgb, size_t w, size_t h)
+    {
+        using pixel_format::RawFormat;
+        const auto luma = [](const uint8_t* p)
+        {
+            return pixel_format::clampByte(0.299f * p[0] + 0.587f * p[1] + 0.114f * p[2]);
+        };
+        std::vector<uint8_t> out;
+        if (format == RawFormat::RGB565)
+            for (size_t i = 0; i < w * h; ++i)
+            {
+                const uint8_t* p = rgb.data() + i * 3;
+                const auto v = static_cast<uint16_t>(((p[0] >> 3) << 11) | ((p[1] >> 2) << 5) | (p[2] >> 3));
+                out.push_back(static_cast<uint8_t>(v));
+                out.push_back(static_cast<uint8_t>(v >> 8));
+            }
+        else
+            for (size_t i = 0; i < w * h; ++i)
+                out.push_back(luma(rgb.data() + i * 3));
+        if (format != RawFormat::YUV420)
+            return out;
+        std::vector<uint8_t> v;
+        for (size_t y = 0; y < h; y += 2)
+            for (size_t x = 0; x < w; x += 2)
+            {
+                float sum[3] = {0.f, 0.f, 0.f};
+                for (size_t k = 0; k < 4; ++k)
+                {
+                    const size_t px = std::min(x + k % 2, w - 1);
+                    const size_t py = std::min(y + k / 2, h - 1);
+                    for (size_t c = 0; c < 3; ++c)
+                        sum[c] += rgb[(py * w + px) * 3 + c];
+                }
+                const float r = sum[0] * 0.25f;
+                const float g = sum[1] * 0.25f;
+                const float b = sum[2] * 0.25f;
+                out.push_back(pixel_format::clampByte(-0.168736f * r - 0.331264f * g + 0.5f * b + 128.f));
+                v.push_back(pixel_format::clampByte(0.5f * r - 0.418688f * g - 0.081312f * b + 128.f));
+            }
+        out.insert(out.end(), v.begin(), v.end());
+        return out;
+    }
+
+    //widths are odd so vector loops always leave a tail; SSE2 rounds half to even, so luma and chroma may differ by 1
+    void testRawConverters()
+    {
+        using pixel_format::RawFormat;
+        uint32_t seed = 7;
+        for (size_t w : {1u, 15u, 17u, 31u, 33u, 63u, 65u, 641u})
+            for (size_t h : {1u, 2u, 3u, 5u})
+            {
+                std::vector<uint8_t> rgb(w * h * 3);
+                for (size_t i = 0; i < rgb.size(); ++i)
+                {
+                    seed = seed * 1103515245u + 12345u;
+                    //half of the lines are smooth, so 2x2 averages are not always noise
+                    rgb[i] = (i / (w * 3)) % 2 ? static_cast<uint8_t>(i / 3 + i % 3 * 80) : static_cast<uint8_t>(seed >> 16);
+                }
+                for (auto format : {RawFormat::RGB565, RawFormat::GRAY8, RawFormat::YUV420})
+                {
+                    const auto expected = scalarRaw(format, rgb, w, h);
+                    std::vector<uint8_t> converted{42};
+                    pixel_format::appendConverted(format, rgb.data(), w, h, converted);
+                    CHECK(converted.size() == expected.size() + 1 && converted[0] == 42);
+                    if (converted.size() != expected.size() + 1)
+                        continue;
+                    int worst = 0;
+                    for (size_t i = 0; i < expected.size(); ++i)
+                        worst = std::max(worst, std::abs(converted[i + 1] - expected[i]));
+                    CHECK(worst <= ((format == RawFormat::RGB565) ? 0 : 1));
+                }
+            }
+
+        constexpr int W = 1920;
+        constexpr int H = 1080;
+        const auto rgb = makePicture(W, H);
+        std::vector<uint8_t> out;
+        for (auto format : {RawFormat::RGB565, RawFormat::GRAY8, RawFormat::YUV420})
+        {
+            const double ms = msPerRun(20, [&]()
+            {
+                out.clear();
+                pixel_format::appendConverted(format, rgb.data(), W, H, out);
+            });
+            std::cout << "raw format " << static_cast<int>(format) << " 1920x1080: " << ms << " ms" << std::endl;
+        }
+    }
+
+    //cur is built of (unchanged, changed) byte runs of given lengths over ref
+    std::vector<uint8_t> xorCurrent(const std::vector<uint8_t>& ref, const std::vector<std::pair<size_t, size_t>>& runs)
+    {
+        auto cur = ref;
+        size_t pos = 0;
+        for (const auto& r : runs)
+        {
+            pos += r.first;
+            for (size_t k = 0; k < r.second; ++k)
+                cur[pos++] ^= static_cast<uint8_t>(1 + (k % 255));
+        }
+        return cur;
+    }
+
+    bool xorRoundTrip(const std::vector<uint8_t>& ref, const std::vector<uint8_t>& cur, std::vector<uint8_t>& payload)
+    {
+        payload.clear();
+        frame_codec::appendXorDelta(cur, ref, 0x0102030405060708ll, payload);
+        const uint8_t timestamp[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+        if (payload.size() < 8 || !std::equal(timestamp, timestamp + 8, payload.begin()))
+            return false;
+        auto applied = ref;
+        return frame_codec::applyXorDelta(payload.data() + 8, payload.size() - 8, applied) && applied == cur;
+    }
+
+    size_t varintSize(size_t v)
+    {
+        std::vector<uint8_t> tmp;
+        frame_codec::appendVarint(v, tmp);
+        return tmp.size();
+    }
+
+    void testXorDelta()
+    {
+        std::vector<uint8_t> ref(100000);
+        uint32_t seed = 4242;
+        for (auto& b : ref)
+        {
+            seed = seed * 1103515245u + 12345u;
+            b = static_cast<uint8_t>(seed >> 16);
+        }
+        std::vector<uint8_t> payload;
+
+        CHECK(varintSize(127) == 1 && varintSize(128) == 2 && varintSize(16383) == 2 && varintSize(16384) == 3);
+
+        //run lengths right at varint size steps, both as unchanged and as literal runs
+        for (size_t n : {1u, 4u, 7u, 8u, 9u, 127u, 128u, 129u, 16383u, 16384u, 16385u})
+        {
+            const auto cur = xorCurrent(ref, {{n, n}, {n + 4, 3}});
+            CHECK(xorRoundTrip(ref, cur, payload));
+            //literal is followed by more than 4 unchanged bytes, so first pair is exactly (n, n)
+            std::vector<uint8_t> first;
+            frame_codec::appendVarint(n, first);
+            frame_codec::appendVarint(n, first);
+            CHECK(std::equal(first.begin(), first.end(), payload.begin() + 8));
+        }
+
+        //short unchanged gaps stay inside literal, cur ending with literal or zeros, nothing changed
+        CHECK(xorRoundTrip(ref, xorCurrent(ref, {{0, 10}, {2, 10}, {3, 10}}), payload));
+        CHECK(xorRoundTrip(ref, xorCurrent(ref, {{ref.size() - 5, 5}}), payload));
+        CHECK(xorRoundTrip(ref, ref, payload));
+        CHECK(xorRoundTrip(ref, xorCurrent(ref, {{0, ref.size()}}), payload));
+
+        //literal past the end of reference is rejected
+        payload.clear();
+        frame_codec::appendVarint(ref.size() - 2, payload);
+        frame_codec::appendVarint(3, payload);
+        payload.insert(payload.end(), {1, 2, 3});
+        auto applied = ref;
+        CHECK(!frame_codec::applyXorDelta(payload.data(), payload.size(), applied));
+        //and so is literal shorter than declared
+        payload.pop_back();
+        payload[0] = 0;
+        payload.resize(1);
+        frame_codec::appendVarint(3, payload);
+        payload.push_back(1);
+        CHECK(!frame_codec::applyXorDelta(payload.data(), payload.size(), applied));
+    }
+
+    //halves encoded by 2 threads and appended give the same frame as one thread does
+    //64 x 64 blocks of picture: flat UI, photo like gradient and many colors with the same blue
+    //(those used to share hash slot when it was taken from low bits)
+    std::vector<uint8_t> makeBlocks(const std::string& kinds)
+    {
+        constexpr int B = 64;
+        const int w = B * static_cast<int>(kinds.size());
+        std::vector<uint8_t> rgb(static_cast<size_t>(w) * B * 3);
+        for (int y = 0; y < B; ++y)
+            for (int x = 0; x < w; ++x)
+            {
+                auto p = rgb.data() + (static_cast<size_t>(y) * w + x) * 3;
+                const int i = x % B;
+                switch (kinds[static_cast<size_t>(x / B)])
+                {
+                case 'u': //window with title bar and text
+                    p[0] = p[1] = p[2] = (y < 12) ? 60 : ((y % 8 == 3 && i % 5 < 3) ? 20 : 240);
+                    break;
+                case 'p':
+                    p[0] = static_cast<uint8_t>(i * 3 + y);
+                    p[1] = static_cast<uint8_t>(y * 3 + i / 2);
+                    p[2] = static_cast<uint8_t>(128 + i - y);
+                    break;
+                case 'b': //100 reds, neighbours differ a lot
+                    p[0] = static_cast<uint8_t>((i * 37 + y * B) % 100 * 2);
+                    p[1] = 0;
+                    p[2] = 77;
+                    break;
+                }
+            }
+        return rgb;
+    }
+
+    void testClassify()
+    {
+        using namespace frame_codec;
+        constexpr int B = 64;
+        const Rect block{0, 0, B, B};
+        CHECK(classifyTile(makeBlocks("u"), B, block) == IMAGE_PNG);
+        CHECK(classifyTile(makeBlocks("p"), B, block) == IMAGE_JPEG);
+        //more than 64 colors, but hard edges between neighbours
+        CHECK(classifyTile(makeBlocks("b"), B, block) == IMAGE_PNG);
+
+        //same codec neighbours in a row become one tile, rows are split by blocks
+        const auto mixed = makeBlocks("uupu");
+        const int w = B * 4;
+        std::vector<std::pair<Rect, int32_t>> runs;
+        splitByContent(mixed, w, Rect{0, 0, w, B}, [&runs](const Rect& r, int32_t codec)
+        {
+            runs.emplace_back(r, codec);
+        });
+        CHECK(runs.size() == 3);
+        if (runs.size() == 3)
+        {
+            CHECK(runs[0].first == (Rect{0, 0, 2 * B, B}) && runs[0].second == IMAGE_PNG);
+            CHECK(runs[1].first == (Rect{2 * B, 0, B, B}) && runs[1].second == IMAGE_JPEG);
+            CHECK(runs[2].first == (Rect{3 * B, 0, B, B}) && runs[2].second == IMAGE_PNG);
+        }
+
+        //area not aligned to blocks: edge blocks are cut, tiles cover area exactly
+        runs.clear();
+        const Rect area{10, 5, w - 30, B - 5};
+        splitByContent(mixed, w, area, [&runs](const Rect& r, int32_t codec)
+        {
+            runs.emplace_back(r, codec);
+        });
+        int covered = 0;
+        for (const auto& run : runs)
+        {
+            CHECK(area.contains(run.first));
+            covered += run.first.w * run.first.h;
+        }
+        CHECK(covered == area.w * area.h);
+    }
+
+    //failed JPEG leaves output as it was, tile encoder may change codec of its header
+    void testJpegFailure()
+    {
+        using namespace frame_codec;
+        std::vector<uint8_t> out{1, 2, 3};
+        const std::vector<uint8_t> rgb(3, 0);
+        CHECK(!appendJpeg(rgb.data(), 0, 1, 75, out));
+        CHECK(out.size() == 3);
+
+        out.clear();
+        TiledFrameWriter tiles(out);
+        tiles.add(Rect{0, 0, 1, 1}, IMAGE_JPEG, 1, [&rgb](std::vector<uint8_t>& payload)
+        {
+            if (appendJpeg(rgb.data(), 0, 1, 75, payload))
+                return IMAGE_JPEG;
+            appendPng(rgb, 1, 1, payload);
+            return IMAGE_PNG;
+        });
+        CHECK(out.size() > TiledFrameWriter::HEADER_SIZE);
+        CHECK(out.size() > 19 && out[19] == IMAGE_PNG);
+    }
+
+    void testVideoRegion()
+    {
+        using frame_codec::Rect;
+        constexpr int W = 1920;
+        constexpr int H = 1080;
+        constexpr int C = VideoRegionDetector::CELL;
+
+        //movie changes every frame: hot after 5 frames (heat 1 + .8 + .64 + .51 + .41 > HOT), kept while paused
+        //until heat decays under COLD
+        {
+            VideoRegionDetector detector;
+            const Rect video{200, 150, 640, 360};
+            for (int frame = 1; frame <= 5; ++frame)
+            {
+                detector.update(W, H, {video, Rect{1500, 1000, 8, 16}});
+                CHECK(detector.region().empty() == (frame < 5));
+            }
+            const auto region = detector.region();
+            CHECK(region.contains(video));
+            CHECK(region.w < video.w + 2 * C && region.h < video.h + 2 * C);
+            int paused = 0;
+            for (; paused < 20 && !detector.region().empty(); ++paused)
+                detector.update(W, H, {});
+            CHECK(paused > 1 && paused < 20);
+        }
+
+        //UI: caret, menus and buttons in different places each frame never get hot
+        {
+            VideoRegionDetector detector;
+            uint32_t seed = 5;
+            bool found = false;
+            for (int frame = 0; frame < 200; ++frame)
+            {
+                std::vector<Rect> dirty{Rect{700, 500, 2, 18}};
+                for (int k = 0; k < 3; ++k)
+                {
+                    seed = seed * 1103515245u + 12345u;
+                    const int x = static_cast<int>((seed >> 8) % (W - 300));
+                    const int y = static_cast<int>((seed >> 20) % (H - 200));
+                    dirty.push_back(Rect{x, y, 60 + static_cast<int>(seed % 240), 20 + static_cast<int>(seed % 180)});
+                }
+                detector.update(W, H, dirty);
+                found = found || !detector.region().empty();
+            }
+            CHECK(!found);
+        }
+
+        //cell aligned areas changing every frame: 16 cells (spinner) are too few, ring of 44 cells around a window
+        //fills 44 / 144 of its box; neither is video
+        {
+            VideoRegionDetector detector;
+            const std::vector<Rect> dirty{Rect{2 * C, 2 * C, 4 * C, 4 * C},
+                                          Rect{14 * C, 3 * C, 12 * C, C}, Rect{14 * C, 14 * C, 12 * C, C},
+                                          Rect{14 * C, 4 * C, C, 10 * C}, Rect{25 * C, 4 * C, C, 10 * C}};
+            for (int frame = 0; frame < 30; ++frame)
+                detector.update(W, H, dirty);
+            CHECK(detector.region().empty());
+            //the same window playing inside
+            for (int frame = 0; frame < 5; ++frame)
+                detector.update(W, H, {Rect{14 * C, 3 * C, 12 * C, 12 * C}});
+            CHECK(detector.region() == (Rect{14 * C, 3 * C, 12 * C, 12 * C}));
+        }
+    }
+
+    void testParallelTiles()
+    {
+        using namespace frame_codec;
+        constexpr int W = 1920;
+        constexpr int H = 1080;
+        const auto rgb = makePicture(W, H);
+        const Rect halves[] = {{0, 0, W / 2, H}, {W / 2, 0, W / 2, H}};
+        const auto addHalf = [&rgb](TiledFrameWriter& tiles, const Rect& r, std::vector<uint8_t>& crop)
+        {
+            cropRGB(rgb, W, r, crop);
+            tiles.add(r, IMAGE_JPEG, 1, [&](std::vector<uint8_t>& out)
+            {
+                appendJpeg(crop.data(), r.w, r.h, 75, out);
+            });
+        };
+
+        std::vector<uint8_t> serial;
+        std::vector<uint8_t> crop;
+        const double one = msPerRun(10, [&]()
+        {
+            serial.clear();
+            TiledFrameWriter tiles(serial);
+            for (const auto& r : halves)
+                addHalf(tiles, r, crop);
+        });
+
+        std::vector<uint8_t> parallel;
+        std::vector<uint8_t> right;
+        std::vector<uint8_t> right_crop;
+        size_t count = 0;
+        const double two = msPerRun(10, [&]()
+        {
+            parallel.clear();
+            right.clear();
+            TiledFrameWriter tiles(parallel);
+            TiledFrameWriter right_tiles(right);
+            std::thread worker([&]()
+            {
+                addHalf(right_tiles, halves[1], right_crop);
+            });
+            addHalf(tiles, halves[0], crop);
+            worker.join();
+            tiles.append(right_tiles);
+            count = tiles.count();
+        });
+        CHECK(count == 2 && parallel == serial);
+        std::cout << "1080p JPEG in 2 tiles: 1 thread " << one << " ms, 2 threads " << two << " ms" << std::endl;
+    }
+}
+
+int main()
+{
+    testJpeg();
+    testQoi();
+    testPng();
+    testXorDelta();
+    testCaptureConversion();
+    testRawConverters();
+    testParallelTiles();
+    testClassify();
+    testJpegFailure();
+    testVideoRegion();
+
+    if (failures)
+    {
+        std::cout << failures << " checks failed." << std::endl;
+        return 1;
+    }
+    std::cout << "All checks passed." << std::endl;
+    return 0;
+}
@@ -0,0 +1,17 @@
+# Codec round trips and encode timings, run without arguments: exit code 0 means all checks passed.
+
+TEMPLATE = app
+TARGET = codec_tests
+CONFIG += console c++17
+CONFIG -= qt app_bundle
+
+SOURCES += codec_tests.cpp
+HEADERS += decoders.h
+
+INCLUDEPATH += $$PWD/.. $$PWD/../../utils
+
+LIBS += -lpthread -ljpeg -lz
+
+QMAKE_CXXFLAGS += -std=c++17 -Wall -Werror=return-type
+CONFIG(release, debug|release): QMAKE_CXXFLAGS += -O3
+unix:!macosx: DEFINES += OS_LINUX
@@ -0,0 +1,122 @@
+#pragma once
+//Reference decoders of what frame_codec writes, shared by tests: pictures are decoded back to RGB888
+//by libjpeg and zlib, not by code under test.
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <jpeglib.h>
+#include <zlib.h>
+
+inline bool decodeJpeg(const std::vector<uint8_t>& jpeg, int& w, int& h, std::vector<uint8_t>& rgb)
+{
+    jpeg_decompress_struct cinfo{};
+    jpeg_error_mgr jerr{};
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_decompress(&cinfo);
+    jpeg_mem_src(&cinfo, jpeg.data(), static_cast<unsigned long>(jpeg.size()));
+    const bool ok = jpeg_read_header(&cinfo, TRUE) == JPEG_HEADER_OK;
+    if (ok)
+    {
+        cinfo.out_color_space = JCS_RGB;
+        jpeg_start_decompress(&cinfo);
+        w = static_cast<int>(cinfo.output_width);
+        h = static_cast<int>(cinfo.output_height);
+        rgb.resize(static_cast<size_t>(w) * h * 3);
+        while (cinfo.output_scanline < cinfo.output_height)
+        {
+            JSAMPROW row = rgb.data() + static_cast<size_t>(cinfo.output_scanline) * w * 3;
+            jpeg_read_scanlines(&cinfo, &row, 1);
+        }
+        jpeg_finish_decompress(&cinfo);
+    }
+    jpeg_destroy_decompress(&cinfo);
+    return ok;
+}
+
+inline double meanAbsError(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b)
+{
+    if (a.size() != b.size() || a.empty())
+        return 255.;
+    uint64_t sum = 0;
+    for (size_t i = 0; i < a.size(); ++i)
+        sum += static_cast<uint64_t>(std::abs(a[i] - b[i]));
+    return static_cast<double>(sum) / a.size();
+}
+
+inline uint32_t bigUint32(const uint8_t* p)
+{
+    return (static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16) | (p[2] << 8) | p[3];
+}
+
+//reference decoder for what TinyPngOut writes: 8 bit RGB or palette, filter 0 on every line;
+//chunk CRCs are checked, IDAT is inflated by zlib
+inline bool decodePng(const std::vector<uint8_t>& png, int& w, int& h, bool& palette, std::vector<uint8_t>& rgb)
+{
+    const uint8_t signature[8] = {0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A};
+    if (png.size() < 8 || !std::equal(signature, signature + 8, png.begin()))
+        return false;
+    std::vector<uint8_t> plte;
+    std::vector<uint8_t> idat;
+    int color_type = -1;
+    bool end = false;
+    for (size_t at = 8; !end; )
+    {
+        if (at + 12 > png.size())
+            return false;
+        const uint32_t length = bigUint32(&png[at]);
+        if (at + 12 + length > png.size())
+            return false;
+        const uint8_t* type = &png[at + 4];
+        const uint8_t* data = type + 4;
+        if (crc32(crc32(0, nullptr, 0), type, length + 4) != bigUint32(data + length))
+            return false;
+        const std::string name(reinterpret_cast<const char*>(type), 4);
+        if (name == "IHDR")
+        {
+            w = static_cast<int>(bigUint32(data));
+            h = static_cast<int>(bigUint32(data + 4));
+            if (data[8] != 8)
+                return false;
+            color_type = data[9];
+        }
+        else if (name == "PLTE")
+            plte.assign(data, data + length);
+        else if (name == "IDAT")
+            idat.insert(idat.end(), data, data + length);
+        else if (name == "IEND")
+            end = true;
+        at += 12 + length;
+    }
+    palette = color_type == 3;
+    if (color_type != 2 && !palette)
+        return false;
+    const size_t bpp = palette ? 1 : 3;
+    const size_t line = static_cast<size_t>(w) * bpp + 1;
+    std::vector<uint8_t> raw(line * h);
+    uLongf raw_size = static_cast<uLongf>(raw.size());
+    if (uncompress(raw.data(), &raw_size, idat.data(), static_cast<uLong>(idat.size())) != Z_OK || raw_size != raw.size())
+        return false;
+    rgb.clear();
+    for (int y = 0; y < h; ++y)
+    {
+        const uint8_t* l = raw.data() + line * y;
+        if (l[0] != 0)
+            return false;
+        for (int x = 0; x < w; ++x)
+        {
+            if (!palette)
+            {
+                rgb.insert(rgb.end(), l + 1 + x * 3, l + 4 + x * 3);
+                continue;
+            }
+            const size_t index = l[1 + x] * 3u;
+            if (index + 3 > plte.size())
+                return false;
+            rgb.insert(rgb.end(), plte.begin() + static_cast<std::ptrdiff_t>(index),
+                       plte.begin() + static_cast<std::ptrdiff_t>(index + 3));
+        }
+    }
+    return true;
+}
@@ -0,0 +1,761 @@
+//FrameEncoder fed with synthetic captures: frames are read back over loopback, tiles are checked for rects, scales
+//and codecs, then drawn by reference client with decoders.h and compared with the captured picture.
+//Non zero exit code means some check failed.
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include "decoders.h"
+#include "loopback.h"
+#include "frame_encoder.h"
+#include "internal/SCCommon.h"
+
+using namespace frame_codec;
+
+namespace
+{
+    int failures = 0;
+
+#define CHECK(COND) do { if (!(COND)) { ++failures; std::cout << "FAILED " << __LINE__ << ": " << #COND << std::endl; } } while (0)
+
+    //RGB888 picture: gradient background, window with text like lines, seed moves both
+    std::vector<uint8_t> makePicture(int w, int h, int seed)
+    {
+        std::vector<uint8_t> rgb(static_cast<size_t>(w) * h * 3);
+        for (int y = 0; y < h; ++y)
+            for (int x = 0; x < w; ++x)
+            {
+                auto p = rgb.data() + (static_cast<size_t>(y) * w + x) * 3;
+                const bool window = x > w / 8 && x < w / 2 && y > h / 8 && y < h * 3 / 4;
+                if (window)
+                    p[0] = p[1] = p[2] = ((y + seed) % 9 < 2 && (x * 7 + y + seed) % 5 < 3) ? 20 : 240;
+                else
+                {
+                    p[0] = static_cast<uint8_t>(x * 255 / w + seed);
+                    p[1] = static_cast<uint8_t>(y * 255 / h);
+                    p[2] = static_cast<uint8_t>(128 + seed * 3);
+                }
+            }
+        return rgb;
+    }
+
+    //left half of the picture repeated in the right one, as mono content in side by side VR
+    std::vector<uint8_t> makeMono(int w, int h, int seed)
+    {
+        auto rgb = makePicture(w / 2, h, seed);
+        std::vector<uint8_t> both;
+        const size_t line = static_cast<size_t>(w / 2) * 3;
+        for (int y = 0; y < h; ++y)
+            for (int eye = 0; eye < 2; ++eye)
+                both.insert(both.end(), rgb.begin() + static_cast<std::ptrdiff_t>(line * y),
+                            rgb.begin() + static_cast<std::ptrdiff_t>(line * (y + 1)));
+        return both;
+    }
+
+    std::vector<uint8_t> crop(const std::vector<uint8_t>& rgb, int w, const Rect& r)
+    {
+        std::vector<uint8_t> out;
+        cropRGB(rgb, w, r, out);
+        return out;
+    }
+
+    //capture buffer as grabber gives it, BGRX contiguous lines
+    class Capture
+    {
+    public:
+        NO_COPYMOVE(Capture);
+
+        Capture(const std::vector<uint8_t>& rgb, int w, int h, bool changed = true): w(w), pixels(static_cast<size_t>(w) * h)
+        {
+            for (size_t i = 0; i < pixels.size(); ++i)
+            {
+                pixels[i].R = rgb[i * 3];
+                pixels[i].G = rgb[i * 3 + 1];
+                pixels[i].B = rgb[i * 3 + 2];
+                pixels[i].A = 0x5A;
+            }
+            whole = SL::Screen_Capture::CreateImage(SL::Screen_Capture::ImageRect(0, 0, w, h), w * 4, pixels.data());
+            whole.isContiguous = true;
+            whole.isChanged = changed;
+        }
+
+        const SL::Screen_Capture::Image& image() const
+        {
+            return whole;
+        }
+
+        //changed area as OnFrameChanged reports it
+        SL::Screen_Capture::Image area(const Rect& r) const
+        {
+            return SL::Screen_Capture::CreateImage(SL::Screen_Capture::ImageRect(r.x, r.y, r.right(), r.bottom()), w * 4,
+                                                   pixels.data() + static_cast<size_t>(r.y) * w + r.x);
+        }
+
+    private:
+        int w;
+        std::vector<SL::Screen_Capture::ImageBGRA> pixels;
+        SL::Screen_Capture::Image whole;
+    };
+
+    struct Tile
+    {
+        Rect r;
+        int32_t codec;
+        int32_t scale;
+        std::vector<uint8_t> payload;
+    };
+
+    struct Frame
+    {
+        int64_t timestamp_ns{0};
+        int32_t flags{0};
+        int32_t w{0};
+        int32_t h{0};
+        std::vector<uint8_t> data;
+        std::vector<Tile> tiles;
+    };
+
+    struct Viewport
+    {
+        int64_t timestamp_ns{0};
+        int64_t pose_timestamp_ns{0};
+        int32_t x{0};
+        int32_t y{0};
+    };
+
+    //replies of one captured picture in order they came
+    struct Sent
+    {
+        std::vector<int16_t> ids;
+        std::vector<Frame> frames;
+        std::vector<Viewport> viewports;
+        size_t ticks{0};
+    };
+
+    bool parseTiles(const std::vector<uint8_t>& data, std::vector<Tile>& tiles)
+    {
+        for (size_t at = 0; at < data.size(); )
+        {
+            if (at + TiledFrameWriter::HEADER_SIZE > data.size())
+                return false;
+            int32_t v[7];
+            for (int i = 0; i < 7; ++i)
+                v[i] = static_cast<int32_t>(bigUint32(&data[at + i * 4]));
+            at += TiledFrameWriter::HEADER_SIZE;
+            if (v[6] < 0 || at + static_cast<size_t>(v[6]) > data.size())
+                return false;
+            tiles.push_back(Tile{Rect{v[0], v[1], v[2], v[3]}, v[4], v[5], std::vector<uint8_t>(data.begin() + static_cast<std::ptrdiff_t>(at),
+                                     data.begin() + static_cast<std::ptrdiff_t>(at + v[6]))});
+            at += static_cast<size_t>(v[6]);
+        }
+        return true;
+    }
+
+    //encoder of one client connection, what it sends is read by other thread meanwhile
+    class Server
+    {
+    public:
+        EncoderSettings settings;
+
+        NO_COPYMOVE(Server);
+
+        Server()
+        {
+            settings.version_client = CLIENT_VERSION_EXTRA_REPLIES;
+            settings.screen_width = 4096;
+            settings.screen_height = 4096;
+            reading = std::thread([this]()
+            {
+                std::vector<uint8_t> chunk(64 * 1024);
+                for (;;)
+                {
+                    boost::system::error_code ec;
+                    const auto n = connection.net.reader.read_some(boost::asio::buffer(chunk), ec);
+                    if (ec)
+                        break;
+                    std::lock_guard<std::mutex> guard(lock);
+                    bytes.insert(bytes.end(), chunk.begin(), chunk.begin() + static_cast<std::ptrdiff_t>(n));
+                    arrived.notify_all();
+                }
+            });
+        }
+
+        ~Server()
+        {
+            connection.net.writer->shutdown(boost::asio::ip::tcp::socket::shutdown_send);
+            reading.join();
+        }
+
+        //one grabbed picture: changed areas, encode, then connection thread sends everything queued
+        Sent capture(const Capture& capture, const std::vector<Rect>& dirty)
+        {
+            for (const auto& r : dirty)
+                encoder.changed(capture.area(r));
+            encoder.encode(capture.image());
+            return flush();
+        }
+
+    private:
+        Connection connection;
+        FrameEncoder encoder{settings, connection.out};
+        std::thread reading;
+        std::mutex lock;
+        std::condition_variable arrived;
+        std::vector<uint8_t> bytes;
+
+        //tick of negative time written after all replies marks their end
+        Sent flush()
+        {
+            namespace span = protocol::span;
+            using namespace protocol::broadcast;
+            connection.flushAll();
+            std::vector<uint8_t> mark;
+            span::Writer writer(mark);
+            writer.header(span::messageId<reply::tick>(), 1);
+            writer.putInt(span::label<&reply::tick::timestamp_ns>(), -1);
+            boost::asio::write(*connection.net.writer, boost::asio::buffer(mark));
+
+            std::vector<uint8_t> received;
+            {
+                std::unique_lock<std::mutex> guard(lock);
+                arrived.wait(guard, [this, &mark]()
+                {
+                    return bytes.size() >= mark.size() && std::equal(mark.rbegin(), mark.rend(), bytes.rbegin());
+                });
+                received.swap(bytes);
+            }
+
+            Sent sent;
+            span::Parser parser(1 << 26);
+            std::copy(received.begin(), received.end(), parser.prepare(received.size()));
+            parser.commit(received.size());
+            span::MessageView view;
+            while (parser.next(view) == span::Status::Complete)
+            {
+                if (view.id == span::messageId<reply::frame>())
+                {
+                    Frame f;
+                    span::Bytes data;
+                    CHECK(view.get(span::label<&reply::frame::data>(), data) &&
+                          view.get(span::label<&reply::frame::timestamp_ns>(), f.timestamp_ns) &&
+                          view.get(span::label<&reply::frame::flags>(), f.flags) && view.get(span::label<&reply::frame::w>(), f.w) &&
+                          view.get(span::label<&reply::frame::h>(), f.h));
+                    f.data.assign(data.data, data.data + data.size);
+                    if (f.flags & IMAGE_TILED)
+                        CHECK(parseTiles(f.data, f.tiles));
+                    sent.frames.push_back(std::move(f));
+                }
+                else if (view.id == span::messageId<reply::viewport>())
+                {
+                    Viewport v;
+                    CHECK(view.get(span::label<&reply::viewport::timestamp_ns>(), v.timestamp_ns) &&
+                          view.get(span::label<&reply::viewport::pose_timestamp_ns>(), v.pose_timestamp_ns) &&
+                          view.get(span::label<&reply::viewport::x>(), v.x) && view.get(span::label<&reply::viewport::y>(), v.y));
+                    sent.viewports.push_back(v);
+                }
+                else if (view.id == span::messageId<reply::tick>())
+                {
+                    int64_t timestamp_ns = 0;
+                    view.get(span::label<&reply::tick::timestamp_ns>(), timestamp_ns);
+                    if (timestamp_ns < 0)
+                        break;
+                    ++sent.ticks;
+                }
+                sent.ids.push_back(view.id);
+            }
+            return sent;
+        }
+    };
+
+    //reference client: draws frames into its picture, reduced tiles are scaled up by repeating pixels
+    struct Client
+    {
+        int w{0};
+        int h{0};
+        std::vector<uint8_t> rgb;
+        bool ok{true};
+
+        void draw(const Sent& sent)
+        {
+            for (const auto& f : sent.frames)
+                draw(f);
+        }
+
+        void draw(const Frame& f)
+        {
+            if (!(f.flags & IMAGE_TILED))
+            {
+                w = f.w;
+                h = f.h;
+                ok = ok && decode(f.flags, f.data, Rect{0, 0, w, h}, 1, rgb);
+                return;
+            }
+            if (!(f.flags & IMAGE_DELTA))
+            {
+                w = f.w;
+                h = f.h;
+                rgb.assign(static_cast<size_t>(w) * h * 3, 0);
+            }
+            ok = ok && f.w == w && f.h == h;
+            for (const auto& t : f.tiles)
+                ok = ok && drawTile(t);
+        }
+
+        bool drawTile(const Tile& t)
+        {
+            if (!Rect{0, 0, w, h}.contains(t.r))
+                return false;
+            const size_t line = static_cast<size_t>(w) * 3;
+            if (t.codec == IMAGE_COPY)
+            {
+                if (t.payload.size() != 8)
+                    return false;
+                const Rect src{static_cast<int32_t>(bigUint32(t.payload.data())), static_cast<int32_t>(bigUint32(t.payload.data() + 4)),
+                               t.r.w, t.r.h};
+                if (!Rect{0, 0, w, h}.contains(src))
+                    return false;
+                const auto pixels = crop(rgb, w, src);
+                for (int y = 0; y < t.r.h; ++y)
+                    std::copy_n(pixels.begin() + static_cast<std::ptrdiff_t>(t.r.w * 3 * y), t.r.w * 3,
+                                rgb.begin() + static_cast<std::ptrdiff_t>(line * (t.r.y + y) + t.r.x * 3));
+                return true;
+            }
+            std::vector<uint8_t> pixels;
+            if (t.scale < 1 || !decode(t.codec, t.payload, t.r, t.scale, pixels))
+                return false;
+            const int cw = (t.r.w + t.scale - 1) / t.scale;
+            for (int y = 0; y < t.r.h; ++y)
+                for (int x = 0; x < t.r.w; ++x)
+                    std::copy_n(pixels.begin() + static_cast<std::ptrdiff_t>(((y / t.scale) * cw + x / t.scale) * 3), 3,
+                                rgb.begin() + static_cast<std::ptrdiff_t>(line * (t.r.y + y) + (t.r.x + x) * 3));
+            return true;
+        }
+
+        //payload of r reduced by scale to RGB888, its size must match
+        static bool decode(int32_t codec, const std::vector<uint8_t>& payload, const Rect& r, int scale, std::vector<uint8_t>& pixels)
+        {
+            int dw = 0;
+            int dh = 0;
+            bool palette = false;
+            bool ok = false;
+            if (codec == IMAGE_JPEG)
+                ok = decodeJpeg(payload, dw, dh, pixels);
+            else if (codec == IMAGE_PNG)
+                ok = decodePng(payload, dw, dh, palette, pixels);
+            else if (codec == IMAGE_QOI)
+                ok = qoi::decode(payload.data(), payload.size(), pixels, dw, dh);
+            return ok && dw == (r.w + scale - 1) / scale && dh == (r.h + scale - 1) / scale;
+        }
+
+        std::vector<uint8_t> area(const Rect& r) const
+        {
+            return crop(rgb, w, r);
+        }
+    };
+
+    //runtime tuning: lossless tiled frames are exact, deltas carry changed areas only, unchanged picture is a tick;
+    //scale, codec and quality changed between frames apply to the next one
+    void testTuning()
+    {
+        constexpr int W = 320;
+        constexpr int H = 200;
+        Server server;
+        Client client;
+        server.settings.requested_codec = IMAGE_PNG;
+
+        const auto first = makePicture(W, H, 0);
+        auto sent = server.capture(Capture(first, W, H), {});
+        CHECK(sent.frames.size() == 1 && sent.frames[0].flags == IMAGE_TILED);
+        client.draw(sent);
+        CHECK(client.ok && client.w == W && client.h == H && client.rgb == first);
+
+        const Rect changed{40, 30, 50, 20};
+        auto second = first;
+        for (int y = changed.y; y < changed.bottom(); ++y)
+            for (int x = changed.x; x < changed.right(); ++x)
+                second[(static_cast<size_t>(y) * W + x) * 3] ^= 0xFF;
+        sent = server.capture(Capture(second, W, H), {changed});
+        CHECK(sent.frames.size() == 1 && sent.frames[0].flags == (IMAGE_TILED | IMAGE_DELTA));
+        for (const auto& f : sent.frames)
+            for (const auto& t : f.tiles)
+                CHECK(changed.contains(t.r) && t.codec == IMAGE_PNG && t.scale == 1);
+        client.draw(sent);
+        CHECK(client.ok && client.rgb == second);
+
+        sent = server.capture(Capture(second, W, H, false), {});
+        CHECK(sent.frames.empty() && sent.ticks == 1);
+
+        //half size picture is new keyframe
+        server.settings.requested_scale = 2;
+        sent = server.capture(Capture(second, W, H), {Rect{0, 0, W, H}});
+        CHECK(sent.frames.size() == 1 && sent.frames[0].flags == IMAGE_TILED && sent.frames[0].w == W / 2 && sent.frames[0].h == H / 2);
+        client.draw(sent);
+        CHECK(client.ok && client.w == W / 2);
+        server.settings.requested_scale = 1;
+
+        //whole JPEG frames, quality follows the setting
+        server.settings.requested_codec = IMAGE_JPEG;
+        size_t sizes[2] = {0, 0};
+        int i = 0;
+        for (int quality : {90, 20})
+        {
+            server.settings.jpeg_quality = quality;
+            sent = server.capture(Capture(second, W, H), {Rect{0, 0, W, H}});
+            CHECK(sent.frames.size() == 1 && sent.frames[0].flags == IMAGE_JPEG);
+            client.draw(sent);
+            CHECK(client.ok && client.w == W && meanAbsError(client.rgb, second) < ((quality > 50) ? 3. : 12.));
+            sizes[i++] = sent.frames.empty() ? 0 : sent.frames[0].data.size();
+        }
+        CHECK(sizes[1] < sizes[0] / 2);
+    }
+    //slices: stripes go as IMAGE_SLICE frames of the same time as soon as they are encoded, the last one ends the frame
+    void testSlices()
+    {
+        constexpr int W = 320;
+        constexpr int H = 200;
+        constexpr int SLICES = 4;
+        Server server;
+        Client client;
+        server.settings.requested_codec = IMAGE_PNG;
+        server.settings.slice_count = SLICES;
+
+        const auto picture = makePicture(W, H, 1);
+        auto sent = server.capture(Capture(picture, W, H), {});
+        CHECK(sent.frames.size() == SLICES);
+        for (size_t i = 0; i < sent.frames.size(); ++i)
+        {
+            const auto& f = sent.frames[i];
+            const int top = H * static_cast<int>(i) / SLICES;
+            const Rect stripe{0, top, W, H * static_cast<int>(i + 1) / SLICES - top};
+            CHECK(f.timestamp_ns == sent.frames[0].timestamp_ns);
+            CHECK(((f.flags & IMAGE_SLICE) != 0) == (i + 1 < sent.frames.size()));
+            CHECK(((f.flags & IMAGE_DELTA) != 0) == (i > 0));
+            CHECK(!f.tiles.empty());
+            for (const auto& t : f.tiles)
+                CHECK(stripe.contains(t.r));
+        }
+        client.draw(sent);
+        CHECK(client.ok && client.rgb == picture);
+
+        //change inside of one stripe: that stripe is flushed, the rest of the frame only ends it
+        auto next = picture;
+        const Rect changed{100, 60, 30, 20};
+        for (int y = changed.y; y < changed.bottom(); ++y)
+            for (int x = changed.x; x < changed.right(); ++x)
+                next[(static_cast<size_t>(y) * W + x) * 3 + 1] ^= 0x55;
+        sent = server.capture(Capture(next, W, H), {changed});
+        CHECK(sent.frames.size() == 2);
+        if (sent.frames.size() == 2)
+        {
+            CHECK(sent.frames[0].flags == (IMAGE_TILED | IMAGE_DELTA | IMAGE_SLICE) && !sent.frames[0].tiles.empty());
+            CHECK(sent.frames[1].flags == (IMAGE_TILED | IMAGE_DELTA) && sent.frames[1].tiles.empty());
+        }
+        client.draw(sent);
+        CHECK(client.ok && client.rgb == next);
+    }
+    //tiles of sent frames by scale, false if some has other scale than allowed
+    bool scalesAre(const Sent& sent, std::initializer_list<int32_t> allowed)
+    {
+        for (const auto& f : sent.frames)
+            for (const auto& t : f.tiles)
+                if (std::find(allowed.begin(), allowed.end(), t.scale) == allowed.end())
+                    return false;
+        return true;
+    }
+
+    //progressive: preview 4 times reduced, then layers 2 and 1 while picture stays, exact at the end;
+    //area changed meanwhile starts from preview again and the layer around it goes on
+    void testProgressive()
+    {
+        constexpr int W = 320;
+        constexpr int H = 200;
+        Server server;
+        Client client;
+        server.settings.requested_codec = IMAGE_PNG;
+        server.settings.preview_scale = 4;
+
+        const auto picture = makePicture(W, H, 2);
+        auto sent = server.capture(Capture(picture, W, H), {});
+        CHECK(sent.frames.size() == 1 && sent.frames[0].flags == IMAGE_TILED && scalesAre(sent, {4}));
+        client.draw(sent);
+        const double preview_error = meanAbsError(client.rgb, picture);
+        CHECK(client.ok && preview_error > 0.);
+
+        sent = server.capture(Capture(picture, W, H, false), {});
+        CHECK(sent.frames.size() == 1 && sent.frames[0].flags == (IMAGE_TILED | IMAGE_DELTA) && scalesAre(sent, {2}));
+        client.draw(sent);
+        CHECK(client.ok && meanAbsError(client.rgb, picture) < preview_error);
+
+        sent = server.capture(Capture(picture, W, H, false), {});
+        CHECK(sent.frames.size() == 1 && scalesAre(sent, {1}));
+        client.draw(sent);
+        CHECK(client.ok && client.rgb == picture);
+
+        sent = server.capture(Capture(picture, W, H, false), {});
+        CHECK(sent.frames.empty() && sent.ticks == 1);
+
+        //next picture: preview of layer 2 in progress when part of it changes
+        const auto next = makePicture(W, H, 3);
+        sent = server.capture(Capture(next, W, H), {Rect{0, 0, W, H}});
+        client.draw(sent);
+        sent = server.capture(Capture(next, W, H, false), {});
+        CHECK(scalesAre(sent, {2}));
+        client.draw(sent);
+
+        auto changed_picture = next;
+        const Rect changed{64, 40, 96, 80};
+        for (int y = changed.y; y < changed.bottom(); ++y)
+            for (int x = changed.x; x < changed.right(); ++x)
+                changed_picture[(static_cast<size_t>(y) * W + x) * 3 + 2] ^= 0x33;
+        sent = server.capture(Capture(changed_picture, W, H), {changed});
+        bool cut = !sent.frames.empty();
+        for (const auto& f : sent.frames)
+            for (const auto& t : f.tiles)
+                cut = cut && ((t.scale == 4 && changed.contains(t.r)) || (t.scale == 1 && changed.intersected(t.r).empty()));
+        CHECK(cut);
+        client.draw(sent);
+
+        //both finish: changed area takes two more layers
+        int frames = 0;
+        for (; frames < 5; ++frames)
+        {
+            sent = server.capture(Capture(changed_picture, W, H, false), {});
+            if (sent.frames.empty())
+                break;
+            client.draw(sent);
+        }
+        CHECK(frames == 2);
+        CHECK(client.ok && client.rgb == changed_picture);
+    }
+    //foveation: centers of eyes in full resolution, periphery reduced and never refined
+    void testFoveation()
+    {
+        constexpr int W = 320;
+        constexpr int H = 200;
+        for (int eyes : {1, 2})
+        {
+            Server server;
+            Client client;
+            server.settings.requested_codec = IMAGE_PNG;
+            server.settings.fovea_eyes = eyes;
+            server.settings.fovea_percent = 50;
+            server.settings.periphery_scale = 4;
+
+            std::vector<Rect> centers;
+            for (int e = 0; e < eyes; ++e)
+            {
+                const int ew = W / eyes;
+                centers.push_back(Rect{ew * e + ew / 4, H / 4, ew / 2, H / 2});
+            }
+            const auto picture = makePicture(W, H, 4);
+            auto sent = server.capture(Capture(picture, W, H), {});
+            CHECK(sent.frames.size() == 1);
+            int64_t area = 0;
+            for (const auto& f : sent.frames)
+                for (const auto& t : f.tiles)
+                {
+                    const bool inside = std::any_of(centers.begin(), centers.end(), [&t](const Rect & c)
+                    {
+                        return c.contains(t.r);
+                    });
+                    const bool outside = std::all_of(centers.begin(), centers.end(), [&t](const Rect & c)
+                    {
+                        return c.intersected(t.r).empty();
+                    });
+                    CHECK((inside && t.scale == 1) || (outside && t.scale == 4));
+                    area += static_cast<int64_t>(t.r.w) * t.r.h;
+                }
+            CHECK(area == W * H);
+            client.draw(sent);
+            CHECK(client.ok);
+            for (const auto& c : centers)
+                CHECK(client.area(c) == crop(picture, W, c));
+            CHECK(client.rgb != picture);
+
+            sent = server.capture(Capture(picture, W, H, false), {});
+            CHECK(sent.frames.empty() && sent.ticks == 1);
+        }
+    }
+    bool crossesMiddle(const Sent& sent, int w)
+    {
+        for (const auto& f : sent.frames)
+            for (const auto& t : f.tiles)
+                if (t.r.x < w / 2 && t.r.right() > w / 2)
+                    return true;
+        return false;
+    }
+
+    //side by side: tiles never cross eyes, right eye equal to the left one is copied after left tiles are drawn;
+    //whole frame stereo (JPEG codec) is one tile per eye
+    void testStereo()
+    {
+        constexpr int W = 320;
+        constexpr int H = 200;
+        for (bool mono : {true, false})
+        {
+            Server server;
+            Client client;
+            server.settings.requested_codec = IMAGE_PNG;
+            server.settings.stereo_layout = 1;
+            const auto picture = (mono) ? makeMono(W, H, 5) : makePicture(W, H, 5);
+            auto sent = server.capture(Capture(picture, W, H), {});
+            CHECK(sent.frames.size() == 1 && !crossesMiddle(sent, W));
+            bool copies_last = true;
+            bool copied = false;
+            for (const auto& f : sent.frames)
+                for (const auto& t : f.tiles)
+                {
+                    if (t.codec == IMAGE_COPY)
+                    {
+                        copied = true;
+                        CHECK(t.r.x >= W / 2 && t.payload.size() == 8 && static_cast<int>(bigUint32(t.payload.data())) == t.r.x - W / 2 &&
+                              static_cast<int>(bigUint32(t.payload.data() + 4)) == t.r.y);
+                    }
+                    else
+                        copies_last = copies_last && !copied;
+                    //every right tile of mono picture is a copy
+                    CHECK(!mono || t.r.x < W / 2 || t.codec == IMAGE_COPY);
+                }
+            CHECK(copied == mono && copies_last);
+            client.draw(sent);
+            CHECK(client.ok && client.rgb == picture);
+
+            server.settings.requested_codec = IMAGE_JPEG;
+            sent = server.capture(Capture(picture, W, H), {Rect{0, 0, W, H}});
+            CHECK(sent.frames.size() == 1);
+            if (sent.frames.size() == 1)
+            {
+                const auto& tiles = sent.frames[0].tiles;
+                CHECK(sent.frames[0].flags == IMAGE_TILED && tiles.size() == 2);
+                if (tiles.size() == 2)
+                {
+                    CHECK(tiles[0].r == (Rect{0, 0, W / 2, H}) && tiles[0].codec == IMAGE_JPEG);
+                    CHECK(tiles[1].r == (Rect{W / 2, 0, W / 2, H}) && tiles[1].codec == (mono ? IMAGE_COPY : IMAGE_JPEG));
+                }
+            }
+            client.draw(sent);
+            CHECK(client.ok && meanAbsError(client.rgb, picture) < 5.);
+        }
+    }
+
+    //big work is cut at the middle, worker encodes the right pieces which go after the left ones;
+    //with one core all is encoded by frame thread, so only the picture is checked
+    void testWorkerSplit()
+    {
+        constexpr int W = 640;
+        constexpr int H = 480;
+        Server server;
+        Client client;
+        server.settings.requested_codec = IMAGE_PNG;
+        const auto picture = makePicture(W, H, 6);
+        const auto sent = server.capture(Capture(picture, W, H), {});
+        CHECK(sent.frames.size() == 1);
+        if (std::thread::hardware_concurrency() > 1)
+        {
+            CHECK(!crossesMiddle(sent, W));
+            bool right_seen = false;
+            bool ordered = true;
+            for (const auto& f : sent.frames)
+                for (const auto& t : f.tiles)
+                {
+                    right_seen = right_seen || t.r.x >= W / 2;
+                    ordered = ordered && (t.r.x >= W / 2 || !right_seen);
+                }
+            CHECK(ordered && right_seen);
+        }
+        else
+            std::cout << "single core: worker split is not used, picture checked only" << std::endl;
+        client.draw(sent);
+        CHECK(client.ok && client.rgb == picture);
+    }
+    //late latching: frame is viewport of the latest pose, its reply::viewport goes right before it; small head move
+    //over still picture shifts what client has by copy tile and sends uncovered edges, big one is keyframe
+    void testViewport()
+    {
+        constexpr int W = 640;
+        constexpr int H = 400;
+        constexpr int VW = 160;
+        constexpr int VH = 100;
+        using protocol::span::messageId;
+        using Viewport = protocol::broadcast::reply::viewport;
+        Server server;
+        Client client;
+        server.settings.requested_codec = IMAGE_PNG;
+        const auto picture = makePicture(W, H, 7);
+        EncoderSettings::Pose pose;
+        pose.fov_x = 3600;
+        pose.fov_y = 1800;
+        pose.view_w = VW;
+        pose.view_h = VH;
+
+        //yaw and pitch of 1/16 and 1/8 of fov move view by as much of picture: 40 right, 50 up
+        struct Step
+        {
+            int32_t yaw;
+            int32_t pitch;
+            Rect view;
+            bool keyframe;
+        };
+        const Step steps[] = {{0, 0, Rect{240, 150, VW, VH}, true}, {225, 225, Rect{280, 100, VW, VH}, false},
+            {-1800, 225, Rect{0, 100, VW, VH}, true}
+        };
+        Rect old_view;
+        for (const auto& step : steps)
+        {
+            pose.timestamp_ns += 1000;
+            pose.yaw = step.yaw;
+            pose.pitch = step.pitch;
+            server.settings.setPose(pose);
+            const auto sent = server.capture(Capture(picture, W, H, false), {});
+            CHECK(sent.viewports.size() == 1 && sent.frames.size() == 1);
+            if (sent.viewports.size() != 1 || sent.frames.size() != 1)
+                return;
+            const auto& v = sent.viewports[0];
+            const auto& f = sent.frames[0];
+            CHECK(sent.ids.size() == 2 && sent.ids[0] == messageId<Viewport>());
+            CHECK(v.timestamp_ns == f.timestamp_ns && v.pose_timestamp_ns == pose.timestamp_ns);
+            CHECK(v.x == step.view.x && v.y == step.view.y);
+            CHECK(f.w == VW && f.h == VH && ((f.flags & IMAGE_DELTA) == 0) == step.keyframe);
+            const bool copy_first = !f.tiles.empty() && f.tiles[0].codec == IMAGE_COPY;
+            CHECK(copy_first != step.keyframe);
+            if (copy_first)
+            {
+                //kept part of the frame comes from where it was before the move
+                const int dx = step.view.x - old_view.x;
+                const int dy = step.view.y - old_view.y;
+                const auto& copy = f.tiles[0];
+                CHECK(copy.r == (Rect{0, -dy, VW - dx, VH + dy}));
+                CHECK(static_cast<int>(bigUint32(copy.payload.data())) == copy.r.x + dx &&
+                      static_cast<int>(bigUint32(copy.payload.data() + 4)) == copy.r.y + dy);
+                for (size_t i = 1; i < f.tiles.size(); ++i)
+                    CHECK(copy.r.intersected(f.tiles[i].r).empty());
+            }
+            client.draw(sent);
+            CHECK(client.ok && client.rgb == crop(picture, W, step.view));
+            old_view = step.view;
+        }
+
+        //same pose over still picture is nothing new
+        const auto sent = server.capture(Capture(picture, W, H, false), {});
+        CHECK(sent.frames.empty() && sent.viewports.empty() && sent.ticks == 1);
+    }
+}
+
+int main()
+{
+    testTuning();
+    testSlices();
+    testProgressive();
+    testFoveation();
+    testStereo();
+    testWorkerSplit();
+    testViewport();
+
+    if (failures)
+    {
+        std::cout << failures << " checks failed." << std::endl;
+        return 1;
+    }
+    std::cout << "All checks passed." << std::endl;
+    return 0;
+}
@@ -0,0 +1,31 @@
+# FrameEncoder fed with synthetic captures, frames read back over loopback socket and drawn by reference client:
+# tiled frames, progressive layers, foveation, stereo, viewport and copy tiles.
+# Run without arguments: exit code 0 means all checks passed.
+
+TEMPLATE = app
+TARGET = frame_encoder_tests
+CONFIG += console c++17
+CONFIG -= qt app_bundle
+CONFIG += openmp
+
+openmp {
+    DEFINES *= USING_OPENMP
+    QMAKE_CXXFLAGS *= -fopenmp
+    QMAKE_LFLAGS   *= -fopenmp
+}
+
+SOURCES += frame_encoder_tests.cpp \
+    $$PWD/../frame_encoder.cpp \
+    $$PWD/../screen_capture_lite/src/SCCommon.cpp
+
+HEADERS += decoders.h loopback.h
+
+INCLUDEPATH += $$PWD/.. $$PWD/../../utils
+INCLUDEPATH += $$PWD/../screen_capture_lite/include $$PWD/../screen_capture_lite/include/linux
+include($$PWD/../../NetProto/bproto.pri)
+
+LIBS += -lpthread -ljpeg -lz
+
+QMAKE_CXXFLAGS += -std=c++17 -Wall -Werror=return-type
+CONFIG(release, debug|release): QMAKE_CXXFLAGS += -O3
+unix:!macosx: DEFINES += OS_LINUX
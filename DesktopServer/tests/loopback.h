@@ -0,0 +1,52 @@
+#pragma once
+//ReplyOut writing into connected loopback TCP socket, shared by tests which read back what server sends.
+#include "reply_out.h"
+
+//connected pair of sockets on loopback, writer side is what ReplyOut gets
+struct Loopback
+{
+    boost::asio::io_context context;
+    network::SocketPtr writer;
+    boost::asio::ip::tcp::socket reader{context};
+
+    Loopback()
+    {
+        using tcp = boost::asio::ip::tcp;
+        tcp::acceptor acceptor(context, tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+        writer = std::make_shared<tcp::socket>(context);
+        writer->connect(acceptor.local_endpoint());
+        acceptor.accept(reader);
+    }
+
+    //everything written so far, writer is shut down first
+    std::vector<uint8_t> received()
+    {
+        writer->shutdown(boost::asio::ip::tcp::socket::shutdown_send);
+        std::vector<uint8_t> bytes;
+        boost::system::error_code ec;
+        boost::asio::read(reader, boost::asio::dynamic_buffer(bytes), ec);
+        return bytes;
+    }
+};
+
+//connection thread loop: flushes until there is nothing left
+struct Connection
+{
+    Loopback net;
+    boost::asio::streambuf buffer;
+    std::ostream os{&buffer};
+    SocketWriteLock lock;
+    ReplyOut out{os, lock};
+
+    size_t flushAll()
+    {
+        auto never = []()
+        {
+            return false;
+        };
+        size_t calls = 0;
+        while (out.flush(buffer, net.writer, never))
+            ++calls;
+        return calls;
+    }
+};
@@ -0,0 +1,220 @@
+//ReplyOut over loopback TCP: chunked frames parsed back by span Parser and reassembled must equal the packet,
+//replies sent meanwhile come between chunks, frame slots, purge and lead replies.
+//Non zero exit code means some check failed.
+#include <iostream>
+#include <map>
+#include "loopback.h"
+
+using namespace protocol;
+
+namespace
+{
+    int failures = 0;
+
+#define CHECK(COND) do { if (!(COND)) { ++failures; std::cout << "FAILED " << __LINE__ << ": " << #COND << std::endl; } } while (0)
+
+    //reply::frame of size bytes of data, as encoder writes it
+    std::vector<uint8_t> makeFrame(size_t size, int64_t timestamp_ns)
+    {
+        namespace span = protocol::span;
+        using Frame = broadcast::reply::frame;
+        std::vector<uint8_t> packet;
+        span::Writer writer(packet);
+        writer.header(span::messageId<Frame>(), 5);
+        const auto at = writer.beginBinary(span::label<&Frame::data>());
+        for (size_t i = 0; i < size; ++i)
+            packet.push_back(static_cast<uint8_t>(i * 7 + (i >> 9)));
+        writer.endBinary(at);
+        writer.putInt(span::label<&Frame::timestamp_ns>(), timestamp_ns);
+        writer.putInt(span::label<&Frame::flags>(), 4);
+        writer.putInt(span::label<&Frame::w>(), 640);
+        writer.putInt(span::label<&Frame::h>(), 480);
+        return packet;
+    }
+
+    //stream split into messages: chunks are reassembled, whole messages are kept as they are
+    struct Received
+    {
+        std::vector<std::vector<uint8_t>> messages;
+        std::vector<int16_t> ids;
+        size_t chunks{0};
+        size_t max_chunk{0};
+        bool chunk_order{true};
+    };
+
+    Received split(const std::vector<uint8_t>& bytes)
+    {
+        namespace span = protocol::span;
+        using Chunk = broadcast::reply::chunk;
+        Received r;
+        span::Parser parser(1 << 24);
+        std::copy(bytes.begin(), bytes.end(), parser.prepare(bytes.size()));
+        parser.commit(bytes.size());
+        std::vector<uint8_t> assembled;
+        span::MessageView view;
+        size_t at = 0;
+        while (parser.next(view) == span::Status::Complete)
+        {
+            if (view.id != span::messageId<Chunk>())
+            {
+                r.ids.push_back(view.id);
+                r.messages.emplace_back(bytes.begin() + static_cast<std::ptrdiff_t>(at),
+                                        bytes.begin() + static_cast<std::ptrdiff_t>(at + view.size));
+                at += view.size;
+                continue;
+            }
+            at += view.size;
+            int64_t offset = 0;
+            int64_t total = 0;
+            span::Bytes data;
+            if (!view.get(span::label<&Chunk::offset>(), offset) || !view.get(span::label<&Chunk::total>(), total) ||
+                    !view.get(span::label<&Chunk::data>(), data))
+            {
+                r.chunk_order = false;
+                continue;
+            }
+            r.chunk_order = r.chunk_order && offset == static_cast<int64_t>(assembled.size());
+            ++r.chunks;
+            r.max_chunk = std::max(r.max_chunk, data.size);
+            assembled.insert(assembled.end(), data.data, data.data + data.size);
+            if (static_cast<int64_t>(assembled.size()) == total)
+            {
+                r.ids.push_back(span::messageId<broadcast::reply::frame>());
+                r.messages.push_back(assembled);
+                assembled.clear();
+            }
+        }
+        CHECK(at == bytes.size());
+        return r;
+    }
+
+    void testWhole()
+    {
+        Connection c;
+        const auto frame = makeFrame(100000, 1);
+        auto packet = frame;
+        c.out.sendFrame(packet);
+        CHECK(packet.empty());
+        c.flushAll();
+        CHECK(c.net.received() == frame);
+    }
+
+    void testChunked()
+    {
+        Connection c;
+        c.out.setChunkSize(ReplyOut::MIN_CHUNK_SIZE);
+        const auto frame = makeFrame(100000, 2);
+        auto packet = frame;
+        c.out.sendFrame(packet);
+
+        //replies written while frame goes out come between its chunks
+        broadcast::reply::tick tick;
+        tick.timestamp_ns = 77;
+        auto never = []()
+        {
+            return false;
+        };
+        CHECK(c.out.flush(c.buffer, c.net.writer, never));
+        c.out.send(tick);
+        c.flushAll();
+
+        const auto r = split(c.net.received());
+        CHECK(r.chunk_order);
+        CHECK(r.chunks == (frame.size() + ReplyOut::MIN_CHUNK_SIZE - 1) / ReplyOut::MIN_CHUNK_SIZE);
+        CHECK(r.max_chunk == ReplyOut::MIN_CHUNK_SIZE);
+        CHECK(r.messages.size() == 2 && r.ids[0] == protocol::span::messageId<broadcast::reply::tick>());
+        CHECK(r.messages.size() == 2 && r.messages[1] == frame);
+    }
+
+    //frame started in chunks is finished in MIN_CHUNK_SIZE chunks when client turns chunking off
+    void testChunkingOff()
+    {
+        Connection c;
+        c.out.setChunkSize(10000);
+        const auto frame = makeFrame(50000, 3);
+        auto packet = frame;
+        c.out.sendFrame(packet);
+        auto never = []()
+        {
+            return false;
+        };
+        CHECK(c.out.flush(c.buffer, c.net.writer, never));
+        c.out.setChunkSize(0);
+        c.flushAll();
+
+        const auto r = split(c.net.received());
+        CHECK(r.chunk_order && r.messages.size() == 1 && r.messages[0] == frame);
+        CHECK(r.chunks == 1 + (frame.size() - 10000 + ReplyOut::MIN_CHUNK_SIZE - 1) / ReplyOut::MIN_CHUNK_SIZE);
+    }
+
+    void testSlots()
+    {
+        Connection c;
+        int drained = 0;
+        c.out.setDrainedCallback([&drained]()
+        {
+            ++drained;
+        });
+        for (size_t i = 0; i < ReplyOut::MAX_QUEUED_FRAMES; ++i)
+        {
+            CHECK(c.out.frameSlotFree());
+            auto packet = makeFrame(1000, static_cast<int64_t>(i));
+            c.out.sendFrame(packet);
+        }
+        CHECK(!c.out.frameSlotFree());
+        CHECK(drained == 0);
+        c.flushAll();
+        //refused once, so room is announced once
+        CHECK(drained == 1);
+        CHECK(c.out.frameSlotFree());
+        const auto r = split(c.net.received());
+        CHECK(r.messages.size() == ReplyOut::MAX_QUEUED_FRAMES);
+    }
+
+    void testPurgeAndLead()
+    {
+        namespace span = protocol::span;
+        using Viewport = broadcast::reply::viewport;
+        Connection c;
+        const auto kept = makeFrame(2000, 10);
+        const auto purged = makeFrame(3000, 11);
+        std::vector<uint8_t> lead;
+        span::Writer writer(lead);
+        writer.header(span::messageId<Viewport>(), 4);
+        writer.putInt(span::label<&Viewport::timestamp_ns>(), 10);
+        writer.putInt(span::label<&Viewport::pose_timestamp_ns>(), 9);
+        writer.putInt(span::label<&Viewport::x>(), 1);
+        writer.putInt(span::label<&Viewport::y>(), 2);
+
+        auto packet = kept;
+        c.out.sendFrame(packet, false, &lead);
+        CHECK(!c.out.purgeLastFrame());
+        packet = purged;
+        c.out.sendFrame(packet, true, &lead);
+        CHECK(c.out.purgeLastFrame());
+        CHECK(!c.out.purgeLastFrame());
+        c.flushAll();
+
+        //lead goes right before its frame, purged frame takes its lead with it
+        auto expected = lead;
+        expected.insert(expected.end(), kept.begin(), kept.end());
+        CHECK(c.net.received() == expected);
+    }
+}
+
+int main()
+{
+    testWhole();
+    testChunked();
+    testChunkingOff();
+    testSlots();
+    testPurgeAndLead();
+
+    if (failures)
+    {
+        std::cout << failures << " checks failed." << std::endl;
+        return 1;
+    }
+    std::cout << "All checks passed." << std::endl;
+    return 0;
+}
@@ -0,0 +1,19 @@
+# ReplyOut over loopback socket: chunked frames, replies between chunks, frame slots, purge and lead replies.
+# Run without arguments: exit code 0 means all checks passed.
+
+TEMPLATE = app
+TARGET = reply_out_tests
+CONFIG += console c++17
+CONFIG -= qt app_bundle
+
+SOURCES += reply_out_tests.cpp
+HEADERS += loopback.h
+
+INCLUDEPATH += $$PWD/.. $$PWD/../../utils
+include($$PWD/../../NetProto/bproto.pri)
+
+LIBS += -lpthread
+
+QMAKE_CXXFLAGS += -std=c++17 -Wall -Werror=return-type
+CONFIG(release, debug|release): QMAKE_CXXFLAGS += -O3
+unix:!macosx: DEFINES += OS_LINUX
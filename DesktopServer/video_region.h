@@ -0,0 +1,135 @@
+#pragma once
+#include <vector>
+#include <algorithm>
+#include "frame_codec.h"
+#include "cm_ctors.h"
+
+//Finds rectangle which changes in most of the frames, i.e. movie played in some window.
+//Frame is split into cells, each cell keeps "heat" - decayed amount of frames where it was dirty.
+//Largest connected area of hot cells which fills its bounding box good enough is the video region.
+class VideoRegionDetector
+{
+public:
+    constexpr static int CELL = 64;         //cell size in captured pixels
+    constexpr static float DECAY = 0.8f;    //heat of cell dirty each frame converges to 1 / (1 - DECAY) = 5
+    constexpr static float HOT = 3.3f;      //about 5 dirty frames in a row
+    constexpr static float COLD = 1.0f;     //average heat to drop active region (paused movie)
+    constexpr static int MIN_CELLS = 32;    //2 diff tiles of 256px at least, smaller areas are carets, spinners etc.
+    constexpr static float MIN_FILL = 0.6f; //part of bounding box which must be hot
+
+    VideoRegionDetector() = default;
+    NO_COPYMOVE(VideoRegionDetector);
+
+    //must be called for each captured frame, unchanged frame has empty dirty list
+    void update(int width, int height, const std::vector<frame_codec::Rect>& dirty)
+    {
+        if (width != frame_w || height != frame_h)
+            reset(width, height);
+
+        std::vector<uint8_t> marked(heat.size(), 0);
+        for (const auto& r : dirty)
+        {
+            const auto c = r.intersected(frame_codec::Rect{0, 0, frame_w, frame_h}).shrinked(CELL, CELL);
+            for (int j = c.y; j < c.bottom(); ++j)
+                for (int i = c.x; i < c.right(); ++i)
+                    marked[j * cols + i] = 1;
+        }
+        for (size_t i = 0, sz = heat.size(); i < sz; ++i)
+            heat[i] = heat[i] * DECAY + marked[i];
+
+        const auto candidate = findHotArea();
+        if (!candidate.empty())
+            active = candidate;
+        else
+            if (!active.empty() && averageHeat(active) < COLD)
+                active = frame_codec::Rect();
+    }
+
+    //video rectangle in captured pixels, empty if there is no video
+    frame_codec::Rect region() const
+    {
+        if (active.empty())
+            return active;
+        return frame_codec::Rect{active.x * CELL, active.y * CELL, active.w * CELL, active.h * CELL}
+               .intersected(frame_codec::Rect{0, 0, frame_w, frame_h});
+    }
+
+private:
+    int frame_w{0};
+    int frame_h{0};
+    int cols{0};
+    int rows{0};
+    std::vector<float> heat;
+    frame_codec::Rect active; //in cells
+
+    void reset(int width, int height)
+    {
+        frame_w = width;
+        frame_h = height;
+        cols = (width + CELL - 1) / CELL;
+        rows = (height + CELL - 1) / CELL;
+        heat.assign(static_cast<size_t>(cols) * rows, 0.f);
+        active = frame_codec::Rect();
+    }
+
+    float averageHeat(const frame_codec::Rect& cells) const
+    {
+        float sum = 0;
+        for (int j = cells.y; j < cells.bottom(); ++j)
+            for (int i = cells.x; i < cells.right(); ++i)
+                sum += heat[j * cols + i];
+        return sum / (cells.w * cells.h);
+    }
+
+    //bounding box of the biggest 4-connected area of hot cells or empty
+    frame_codec::Rect findHotArea() const
+    {
+        std::vector<uint8_t> seen(heat.size(), 0);
+        std::vector<int> stack;
+        frame_codec::Rect best;
+        int best_count = 0;
+
+        for (int start = 0, sz = static_cast<int>(heat.size()); start < sz; ++start)
+        {
+            if (seen[start] || heat[start] < HOT)
+                continue;
+
+            frame_codec::Rect box;
+            int count = 0;
+            seen[start] = 1;
+            stack.push_back(start);
+            while (!stack.empty())
+            {
+                const int c = stack.back();
+                stack.pop_back();
+                const int x = c % cols;
+                const int y = c / cols;
+                box = box.united(frame_codec::Rect{x, y, 1, 1});
+                ++count;
+
+                const auto visit = [&](int nx, int ny)
+                {
+                    if (nx < 0 || ny < 0 || nx >= cols || ny >= rows)
+                        return;
+                    const int n = ny * cols + nx;
+                    if (!seen[n] && heat[n] >= HOT)
+                    {
+                        seen[n] = 1;
+                        stack.push_back(n);
+                    }
+                };
+                visit(x - 1, y);
+                visit(x + 1, y);
+                visit(x, y - 1);
+                visit(x, y + 1);
+            }
+
+            if (count > best_count && count >= MIN_CELLS && count >= MIN_FILL * box.w * box.h)
+            {
+                best = box;
+                best_count = count;
+            }
+        }
+        return best;
+    }
+};
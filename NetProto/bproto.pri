@@ -1,7 +1,8 @@
 INCLUDEPATH += $$PWD
 
 HEADERS += \
-    $$PWD/broadcast.h
+    $$PWD/broadcast.h \
+    $$PWD/span_codec.h
 
 SOURCES += \
     $$PWD/broadcast.cpp
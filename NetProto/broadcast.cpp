@@ -10,12 +10,46 @@ namespace broadcast {
 
 static void marshal(protocol::ostream&, request::connect const&);
 static void unmarshal(protocol::istream&, request::connect&);
+static void marshal(protocol::ostream&, request::frame_format const&);
+static void unmarshal(protocol::istream&, request::frame_format&);
+static void marshal(protocol::ostream&, request::ack const&);
+static void unmarshal(protocol::istream&, request::ack&);
+static void marshal(protocol::ostream&, request::pixel_format const&);
+static void unmarshal(protocol::istream&, request::pixel_format&);
+static void marshal(protocol::ostream&, request::chunking const&);
+static void unmarshal(protocol::istream&, request::chunking&);
+static void marshal(protocol::ostream&, request::capabilities const&);
+static void unmarshal(protocol::istream&, request::capabilities&);
+static void marshal(protocol::ostream&, request::tune const&);
+static void unmarshal(protocol::istream&, request::tune&);
+static void marshal(protocol::ostream&, request::slicing const&);
+static void unmarshal(protocol::istream&, request::slicing&);
+static void marshal(protocol::ostream&, request::progressive const&);
+static void unmarshal(protocol::istream&, request::progressive&);
+static void marshal(protocol::ostream&, request::foveation const&);
+static void unmarshal(protocol::istream&, request::foveation&);
+static void marshal(protocol::ostream&, request::stereo const&);
+static void unmarshal(protocol::istream&, request::stereo&);
+static void marshal(protocol::ostream&, request::pose const&);
+static void unmarshal(protocol::istream&, request::pose&);
 static void marshal(protocol::ostream&, reply::Error const&);
 static void unmarshal(protocol::istream&, reply::Error&);
 static void marshal(protocol::ostream&, reply::connected const&);
 static void unmarshal(protocol::istream&, reply::connected&);
 static void marshal(protocol::ostream&, reply::frame const&);
 static void unmarshal(protocol::istream&, reply::frame&);
+static void marshal(protocol::ostream&, reply::tick const&);
+static void unmarshal(protocol::istream&, reply::tick&);
+static void marshal(protocol::ostream&, reply::cursor_shape const&);
+static void unmarshal(protocol::istream&, reply::cursor_shape&);
+static void marshal(protocol::ostream&, reply::cursor_pos const&);
+static void unmarshal(protocol::istream&, reply::cursor_pos&);
+static void marshal(protocol::ostream&, reply::chunk const&);
+static void unmarshal(protocol::istream&, reply::chunk&);
+static void marshal(protocol::ostream&, reply::pipeline const&);
+static void unmarshal(protocol::istream&, reply::pipeline&);
+static void marshal(protocol::ostream&, reply::viewport const&);
+static void unmarshal(protocol::istream&, reply::viewport&);
 
 request::Base::~Base()
 {
@@ -269,6 +303,312 @@ static void unmarshal(protocol::istream& is, request::connect& v)
 	throw std::runtime_error("missing required field(s) while unmarshalling 'request::connect' type");
 }
 
+static void unmarshal(protocol::istream& is, request::frame_format& v)
+{
+    uint32_t flg = 0;
+    size_t const total = readLength(is, 0x50);
+
+    for (size_t ii = 0; ii < total; ii += 2) {
+	switch (readFieldLabel(is, 0x10)) {
+	 case -13468:
+	    unmarshal(is, v.codec);
+	    flg |= 0x1;
+	    break;
+
+	 case 14002:
+	    unmarshal(is, v.quality);
+	    flg |= 0x2;
+	    break;
+
+	 default:
+	    throw std::runtime_error("found unknown field");
+	}
+    }
+
+    if (flg != 0x3)
+	throw std::runtime_error("missing required field(s) while unmarshalling 'request::frame_format' type");
+}
+
+static void unmarshal(protocol::istream& is, request::ack& v)
+{
+    uint32_t flg = 0;
+    size_t const total = readLength(is, 0x50);
+
+    for (size_t ii = 0; ii < total; ii += 2) {
+	switch (readFieldLabel(is, 0x10)) {
+	 case -26436:
+	    unmarshal(is, v.timestamp_ns);
+	    flg |= 0x1;
+	    break;
+
+	 default:
+	    throw std::runtime_error("found unknown field");
+	}
+    }
+
+    if (flg != 0x1)
+	throw std::runtime_error("missing required field(s) while unmarshalling 'request::ack' type");
+}
+
+static void unmarshal(protocol::istream& is, request::pixel_format& v)
+{
+    uint32_t flg = 0;
+    size_t const total = readLength(is, 0x50);
+
+    for (size_t ii = 0; ii < total; ii += 2) {
+	switch (readFieldLabel(is, 0x10)) {
+	 case -18134:
+	    unmarshal(is, v.format);
+	    flg |= 0x1;
+	    break;
+
+	 default:
+	    throw std::runtime_error("found unknown field");
+	}
+    }
+
+    if (flg != 0x1)
+	throw std::runtime_error("missing required field(s) while unmarshalling 'request::pixel_format' type");
+}
+
+static void unmarshal(protocol::istream& is, request::chunking& v)
+{
+    uint32_t flg = 0;
+    size_t const total = readLength(is, 0x50);
+
+    for (size_t ii = 0; ii < total; ii += 2) {
+	switch (readFieldLabel(is, 0x10)) {
+	 case 5155:
+	    unmarshal(is, v.chunk_size);
+	    flg |= 0x1;
+	    break;
+
+	 default:
+	    throw std::runtime_error("found unknown field");
+	}
+    }
+
+    if (flg != 0x1)
+	throw std::runtime_error("missing required field(s) while unmarshalling 'request::chunking' type");
+}
+
+static void unmarshal(protocol::istream& is, request::capabilities& v)
+{
+    uint32_t flg = 0;
+    size_t const total = readLength(is, 0x50);
+
+    for (size_t ii = 0; ii < total; ii += 2) {
+	switch (readFieldLabel(is, 0x10)) {
+	 case -20863:
+	    unmarshal(is, v.codecs);
+	    flg |= 0x1;
+	    break;
+
+	 case 3401:
+	    unmarshal(is, v.pixel_formats);
+	    flg |= 0x2;
+	    break;
+
+	 case -28557:
+	    unmarshal(is, v.max_fps);
+	    flg |= 0x4;
+	    break;
+
+	 case -26914:
+	    unmarshal(is, v.decoder_threads);
+	    flg |= 0x8;
+	    break;
+
+	 default:
+	    throw std::runtime_error("found unknown field");
+	}
+    }
+
+    if (flg != 0xf)
+	throw std::runtime_error("missing required field(s) while unmarshalling 'request::capabilities' type");
+}
+
+static void unmarshal(protocol::istream& is, request::tune& v)
+{
+    uint32_t flg = 0;
+    size_t const total = readLength(is, 0x50);
+
+    for (size_t ii = 0; ii < total; ii += 2) {
+	switch (readFieldLabel(is, 0x10)) {
+	 case -28557:
+	    unmarshal(is, v.max_fps);
+	    flg |= 0x1;
+	    break;
+
+	 case 31467:
+	    unmarshal(is, v.scale);
+	    flg |= 0x2;
+	    break;
+
+	 case -13468:
+	    unmarshal(is, v.codec);
+	    flg |= 0x4;
+	    break;
+
+	 case 14002:
+	    unmarshal(is, v.quality);
+	    flg |= 0x8;
+	    break;
+
+	 default:
+	    throw std::runtime_error("found unknown field");
+	}
+    }
+
+    if (flg != 0xf)
+	throw std::runtime_error("missing required field(s) while unmarshalling 'request::tune' type");
+}
+
+static void unmarshal(protocol::istream& is, request::slicing& v)
+{
+    uint32_t flg = 0;
+    size_t const total = readLength(is, 0x50);
+
+    for (size_t ii = 0; ii < total; ii += 2) {
+	switch (readFieldLabel(is, 0x10)) {
+	 case 31771:
+	    unmarshal(is, v.slices);
+	    flg |= 0x1;
+	    break;
+
+	 default:
+	    throw std::runtime_error("found unknown field");
+	}
+    }
+
+    if (flg != 0x1)
+	throw std::runtime_error("missing required field(s) while unmarshalling 'request::slicing' type");
+}
+
+static void unmarshal(protocol::istream& is, request::progressive& v)
+{
+    uint32_t flg = 0;
+    size_t const total = readLength(is, 0x50);
+
+    for (size_t ii = 0; ii < total; ii += 2) {
+	switch (readFieldLabel(is, 0x10)) {
+	 case 13420:
+	    unmarshal(is, v.preview_scale);
+	    flg |= 0x1;
+	    break;
+
+	 default:
+	    throw std::runtime_error("found unknown field");
+	}
+    }
+
+    if (flg != 0x1)
+	throw std::runtime_error("missing required field(s) while unmarshalling 'request::progressive' type");
+}
+
+static void unmarshal(protocol::istream& is, request::foveation& v)
+{
+    uint32_t flg = 0;
+    size_t const total = readLength(is, 0x50);
+
+    for (size_t ii = 0; ii < total; ii += 2) {
+	switch (readFieldLabel(is, 0x10)) {
+	 case -6299:
+	    unmarshal(is, v.eyes);
+	    flg |= 0x1;
+	    break;
+
+	 case -18844:
+	    unmarshal(is, v.fovea_percent);
+	    flg |= 0x2;
+	    break;
+
+	 case 15564:
+	    unmarshal(is, v.periphery_scale);
+	    flg |= 0x4;
+	    break;
+
+	 default:
+	    throw std::runtime_error("found unknown field");
+	}
+    }
+
+    if (flg != 0x7)
+	throw std::runtime_error("missing required field(s) while unmarshalling 'request::foveation' type");
+}
+
+static void unmarshal(protocol::istream& is, request::stereo& v)
+{
+    uint32_t flg = 0;
+    size_t const total = readLength(is, 0x50);
+
+    for (size_t ii = 0; ii < total; ii += 2) {
+	switch (readFieldLabel(is, 0x10)) {
+	 case 1173:
+	    unmarshal(is, v.layout);
+	    flg |= 0x1;
+	    break;
+
+	 default:
+	    throw std::runtime_error("found unknown field");
+	}
+    }
+
+    if (flg != 0x1)
+	throw std::runtime_error("missing required field(s) while unmarshalling 'request::stereo' type");
+}
+
+static void unmarshal(protocol::istream& is, request::pose& v)
+{
+    uint32_t flg = 0;
+    size_t const total = readLength(is, 0x50);
+
+    for (size_t ii = 0; ii < total; ii += 2) {
+	switch (readFieldLabel(is, 0x10)) {
+	 case -26436:
+	    unmarshal(is, v.timestamp_ns);
+	    flg |= 0x1;
+	    break;
+
+	 case -22972:
+	    unmarshal(is, v.yaw);
+	    flg |= 0x2;
+	    break;
+
+	 case -18529:
+	    unmarshal(is, v.pitch);
+	    flg |= 0x4;
+	    break;
+
+	 case -31155:
+	    unmarshal(is, v.fov_x);
+	    flg |= 0x8;
+	    break;
+
+	 case 24713:
+	    unmarshal(is, v.fov_y);
+	    flg |= 0x10;
+	    break;
+
+	 case 20337:
+	    unmarshal(is, v.view_w);
+	    flg |= 0x20;
+	    break;
+
+	 case -15685:
+	    unmarshal(is, v.view_h);
+	    flg |= 0x40;
+	    break;
+
+	 default:
+	    throw std::runtime_error("found unknown field");
+	}
+    }
+
+    if (flg != 0x7f)
+	throw std::runtime_error("missing required field(s) while unmarshalling 'request::pose' type");
+}
+
 static void unmarshal(protocol::istream& is, reply::Error& v)
 {
     uint32_t flg = 0;
@@ -281,88 +621,1562 @@ static void unmarshal(protocol::istream& is, reply::Error& v)
 	    flg |= 0x1;
 	    break;
 
-	 case 12546:
-	    unmarshal(is, v.message);
-	    flg |= 0x2;
-	    break;
+	 case 12546:
+	    unmarshal(is, v.message);
+	    flg |= 0x2;
+	    break;
+
+	 default:
+	    throw std::runtime_error("found unknown field");
+	}
+    }
+
+    if (flg != 0x3)
+	throw std::runtime_error("missing required field(s) while unmarshalling 'reply::Error' type");
+}
+
+static void unmarshal(protocol::istream& is, reply::connected& v)
+{
+    uint32_t flg = 0;
+    size_t const total = readLength(is, 0x50);
+
+    for (size_t ii = 0; ii < total; ii += 2) {
+	switch (readFieldLabel(is, 0x10)) {
+	 case -3889:
+	    unmarshal(is, v.server_version);
+	    flg |= 0x1;
+	    break;
+
+	 default:
+	    throw std::runtime_error("found unknown field");
+	}
+    }
+
+    if (flg != 0x1)
+	throw std::runtime_error("missing required field(s) while unmarshalling 'reply::connected' type");
+}
+
+static void unmarshal(protocol::istream& is, reply::frame& v)
+{
+    uint32_t flg = 0;
+    size_t const total = readLength(is, 0x50);
+
+    for (size_t ii = 0; ii < total; ii += 2) {
+	switch (readFieldLabel(is, 0x10)) {
+	 case -26436:
+	    unmarshal(is, v.timestamp_ns);
+	    flg |= 0x1;
+	    break;
+
+	 case 26838:
+	    unmarshal(is, v.flags);
+	    flg |= 0x2;
+	    break;
+
+	 case 390:
+	    unmarshal(is, v.w);
+	    flg |= 0x4;
+	    break;
+
+	 case -15472:
+	    unmarshal(is, v.h);
+	    flg |= 0x8;
+	    break;
+
+	 case 32568:
+	    unmarshal(is, v.data);
+	    flg |= 0x10;
+	    break;
+
+	 default:
+	    throw std::runtime_error("found unknown field");
+	}
+    }
+
+    if (flg != 0x1f)
+	throw std::runtime_error("missing required field(s) while unmarshalling 'reply::frame' type");
+}
+
+static void unmarshal(protocol::istream& is, reply::tick& v)
+{
+    uint32_t flg = 0;
+    size_t const total = readLength(is, 0x50);
+
+    for (size_t ii = 0; ii < total; ii += 2) {
+	switch (readFieldLabel(is, 0x10)) {
+	 case -26436:
+	    unmarshal(is, v.timestamp_ns);
+	    flg |= 0x1;
+	    break;
+
+	 default:
+	    throw std::runtime_error("found unknown field");
+	}
+    }
+
+    if (flg != 0x1)
+	throw std::runtime_error("missing required field(s) while unmarshalling 'reply::tick' type");
+}
+
+static void unmarshal(protocol::istream& is, reply::cursor_shape& v)
+{
+    uint32_t flg = 0;
+    size_t const total = readLength(is, 0x50);
+
+    for (size_t ii = 0; ii < total; ii += 2) {
+	switch (readFieldLabel(is, 0x10)) {
+	 case 27428:
+	    unmarshal(is, v.serial);
+	    flg |= 0x1;
+	    break;
+
+	 case 17282:
+	    unmarshal(is, v.hot_x);
+	    flg |= 0x2;
+	    break;
+
+	 case -31564:
+	    unmarshal(is, v.hot_y);
+	    flg |= 0x4;
+	    break;
+
+	 case 390:
+	    unmarshal(is, v.w);
+	    flg |= 0x8;
+	    break;
+
+	 case -15472:
+	    unmarshal(is, v.h);
+	    flg |= 0x10;
+	    break;
+
+	 case 32568:
+	    unmarshal(is, v.data);
+	    flg |= 0x20;
+	    break;
+
+	 default:
+	    throw std::runtime_error("found unknown field");
+	}
+    }
+
+    if (flg != 0x3f)
+	throw std::runtime_error("missing required field(s) while unmarshalling 'reply::cursor_shape' type");
+}
+
+static void unmarshal(protocol::istream& is, reply::cursor_pos& v)
+{
+    uint32_t flg = 0;
+    size_t const total = readLength(is, 0x50);
+
+    for (size_t ii = 0; ii < total; ii += 2) {
+	switch (readFieldLabel(is, 0x10)) {
+	 case 27428:
+	    unmarshal(is, v.serial);
+	    flg |= 0x1;
+	    break;
+
+	 case -7071:
+	    unmarshal(is, v.x);
+	    flg |= 0x2;
+	    break;
+
+	 case -28554:
+	    unmarshal(is, v.y);
+	    flg |= 0x4;
+	    break;
+
+	 default:
+	    throw std::runtime_error("found unknown field");
+	}
+    }
+
+    if (flg != 0x7)
+	throw std::runtime_error("missing required field(s) while unmarshalling 'reply::cursor_pos' type");
+}
+
+static void unmarshal(protocol::istream& is, reply::chunk& v)
+{
+    uint32_t flg = 0;
+    size_t const total = readLength(is, 0x50);
+
+    for (size_t ii = 0; ii < total; ii += 2) {
+	switch (readFieldLabel(is, 0x10)) {
+	 case -16041:
+	    unmarshal(is, v.offset);
+	    flg |= 0x1;
+	    break;
+
+	 case 19268:
+	    unmarshal(is, v.total);
+	    flg |= 0x2;
+	    break;
+
+	 case 32568:
+	    unmarshal(is, v.data);
+	    flg |= 0x4;
+	    break;
+
+	 default:
+	    throw std::runtime_error("found unknown field");
+	}
+    }
+
+    if (flg != 0x7)
+	throw std::runtime_error("missing required field(s) while unmarshalling 'reply::chunk' type");
+}
+
+static void unmarshal(protocol::istream& is, reply::pipeline& v)
+{
+    uint32_t flg = 0;
+    size_t const total = readLength(is, 0x50);
+
+    for (size_t ii = 0; ii < total; ii += 2) {
+	switch (readFieldLabel(is, 0x10)) {
+	 case -13468:
+	    unmarshal(is, v.codec);
+	    flg |= 0x1;
+	    break;
+
+	 case 25671:
+	    unmarshal(is, v.lossless_codec);
+	    flg |= 0x2;
+	    break;
+
+	 case -28557:
+	    unmarshal(is, v.max_fps);
+	    flg |= 0x4;
+	    break;
+
+	 default:
+	    throw std::runtime_error("found unknown field");
+	}
+    }
+
+    if (flg != 0x7)
+	throw std::runtime_error("missing required field(s) while unmarshalling 'reply::pipeline' type");
+}
+
+static void unmarshal(protocol::istream& is, reply::viewport& v)
+{
+    uint32_t flg = 0;
+    size_t const total = readLength(is, 0x50);
+
+    for (size_t ii = 0; ii < total; ii += 2) {
+	switch (readFieldLabel(is, 0x10)) {
+	 case -26436:
+	    unmarshal(is, v.timestamp_ns);
+	    flg |= 0x1;
+	    break;
+
+	 case 3168:
+	    unmarshal(is, v.pose_timestamp_ns);
+	    flg |= 0x2;
+	    break;
+
+	 case -7071:
+	    unmarshal(is, v.x);
+	    flg |= 0x4;
+	    break;
+
+	 case -28554:
+	    unmarshal(is, v.y);
+	    flg |= 0x8;
+	    break;
+
+	 default:
+	    throw std::runtime_error("found unknown field");
+	}
+    }
+
+    if (flg != 0xf)
+	throw std::runtime_error("missing required field(s) while unmarshalling 'reply::viewport' type");
+}
+
+static void marshal(protocol::ostream& os, request::connect const& v)
+{
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(81),
+	    static_cast<protocol::byte>(8)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(26),
+	    static_cast<protocol::byte>(-81)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.version_client);
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(-126),
+	    static_cast<protocol::byte>(-7)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.screen_width);
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(4),
+	    static_cast<protocol::byte>(110)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.screen_height);
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(82),
+	    static_cast<protocol::byte>(-59)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.win_caption);
+}
+
+void request::connect::marshal(protocol::ostream& os) const
+{
+    class exMan {
+      std::ios::iostate const orig;
+      protocol::ostream& os;
+     public:
+      explicit exMan(protocol::ostream& s) : orig(s.exceptions()), os(s)
+      {
+        os.exceptions(std::ios::failbit | std::ios::badbit);
+        std::noskipws(os);
+      }
+	   ~exMan() { os.exceptions(orig); }
+    } em(os);
+
+    os << "SDD\x02\x51\x03";
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(20),
+	    static_cast<protocol::byte>(-74),
+	    static_cast<protocol::byte>(5),
+	    static_cast<protocol::byte>(-22),
+	    static_cast<protocol::byte>(96)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(54),
+	    static_cast<protocol::byte>(55)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    protocol::broadcast::marshal(os, *this);
+}
+
+static void marshal(protocol::ostream& os, request::frame_format const& v)
+{
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(81),
+	    static_cast<protocol::byte>(4)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(-53),
+	    static_cast<protocol::byte>(100)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.codec);
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(54),
+	    static_cast<protocol::byte>(-78)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.quality);
+}
+
+void request::frame_format::marshal(protocol::ostream& os) const
+{
+    class exMan {
+      std::ios::iostate const orig;
+      protocol::ostream& os;
+     public:
+      explicit exMan(protocol::ostream& s) : orig(s.exceptions()), os(s)
+      {
+        os.exceptions(std::ios::failbit | std::ios::badbit);
+        std::noskipws(os);
+      }
+	   ~exMan() { os.exceptions(orig); }
+    } em(os);
+
+    os << "SDD\x02\x51\x03";
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(20),
+	    static_cast<protocol::byte>(-74),
+	    static_cast<protocol::byte>(5),
+	    static_cast<protocol::byte>(-22),
+	    static_cast<protocol::byte>(96)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(-89),
+	    static_cast<protocol::byte>(-85)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    protocol::broadcast::marshal(os, *this);
+}
+
+static void marshal(protocol::ostream& os, request::ack const& v)
+{
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(81),
+	    static_cast<protocol::byte>(2)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(-104),
+	    static_cast<protocol::byte>(-68)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.timestamp_ns);
+}
+
+void request::ack::marshal(protocol::ostream& os) const
+{
+    class exMan {
+      std::ios::iostate const orig;
+      protocol::ostream& os;
+     public:
+      explicit exMan(protocol::ostream& s) : orig(s.exceptions()), os(s)
+      {
+        os.exceptions(std::ios::failbit | std::ios::badbit);
+        std::noskipws(os);
+      }
+	   ~exMan() { os.exceptions(orig); }
+    } em(os);
+
+    os << "SDD\x02\x51\x03";
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(20),
+	    static_cast<protocol::byte>(-74),
+	    static_cast<protocol::byte>(5),
+	    static_cast<protocol::byte>(-22),
+	    static_cast<protocol::byte>(96)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(49),
+	    static_cast<protocol::byte>(-78)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    protocol::broadcast::marshal(os, *this);
+}
+
+static void marshal(protocol::ostream& os, request::pixel_format const& v)
+{
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(81),
+	    static_cast<protocol::byte>(2)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(-71),
+	    static_cast<protocol::byte>(42)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.format);
+}
+
+void request::pixel_format::marshal(protocol::ostream& os) const
+{
+    class exMan {
+      std::ios::iostate const orig;
+      protocol::ostream& os;
+     public:
+      explicit exMan(protocol::ostream& s) : orig(s.exceptions()), os(s)
+      {
+        os.exceptions(std::ios::failbit | std::ios::badbit);
+        std::noskipws(os);
+      }
+	   ~exMan() { os.exceptions(orig); }
+    } em(os);
+
+    os << "SDD\x02\x51\x03";
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(20),
+	    static_cast<protocol::byte>(-74),
+	    static_cast<protocol::byte>(5),
+	    static_cast<protocol::byte>(-22),
+	    static_cast<protocol::byte>(96)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(-74),
+	    static_cast<protocol::byte>(97)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    protocol::broadcast::marshal(os, *this);
+}
+
+static void marshal(protocol::ostream& os, request::chunking const& v)
+{
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(81),
+	    static_cast<protocol::byte>(2)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(20),
+	    static_cast<protocol::byte>(35)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.chunk_size);
+}
+
+void request::chunking::marshal(protocol::ostream& os) const
+{
+    class exMan {
+      std::ios::iostate const orig;
+      protocol::ostream& os;
+     public:
+      explicit exMan(protocol::ostream& s) : orig(s.exceptions()), os(s)
+      {
+        os.exceptions(std::ios::failbit | std::ios::badbit);
+        std::noskipws(os);
+      }
+	   ~exMan() { os.exceptions(orig); }
+    } em(os);
+
+    os << "SDD\x02\x51\x03";
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(20),
+	    static_cast<protocol::byte>(-74),
+	    static_cast<protocol::byte>(5),
+	    static_cast<protocol::byte>(-22),
+	    static_cast<protocol::byte>(96)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(-118),
+	    static_cast<protocol::byte>(50)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    protocol::broadcast::marshal(os, *this);
+}
+
+static void marshal(protocol::ostream& os, request::capabilities const& v)
+{
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(81),
+	    static_cast<protocol::byte>(8)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(-82),
+	    static_cast<protocol::byte>(-127)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.codecs);
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(13),
+	    static_cast<protocol::byte>(73)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.pixel_formats);
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(-112),
+	    static_cast<protocol::byte>(115)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.max_fps);
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(-106),
+	    static_cast<protocol::byte>(-34)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.decoder_threads);
+}
+
+void request::capabilities::marshal(protocol::ostream& os) const
+{
+    class exMan {
+      std::ios::iostate const orig;
+      protocol::ostream& os;
+     public:
+      explicit exMan(protocol::ostream& s) : orig(s.exceptions()), os(s)
+      {
+        os.exceptions(std::ios::failbit | std::ios::badbit);
+        std::noskipws(os);
+      }
+	   ~exMan() { os.exceptions(orig); }
+    } em(os);
+
+    os << "SDD\x02\x51\x03";
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(20),
+	    static_cast<protocol::byte>(-74),
+	    static_cast<protocol::byte>(5),
+	    static_cast<protocol::byte>(-22),
+	    static_cast<protocol::byte>(96)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(81)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    protocol::broadcast::marshal(os, *this);
+}
+
+static void marshal(protocol::ostream& os, request::tune const& v)
+{
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(81),
+	    static_cast<protocol::byte>(8)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(-112),
+	    static_cast<protocol::byte>(115)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.max_fps);
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(122),
+	    static_cast<protocol::byte>(-21)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.scale);
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(-53),
+	    static_cast<protocol::byte>(100)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.codec);
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(54),
+	    static_cast<protocol::byte>(-78)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.quality);
+}
+
+void request::tune::marshal(protocol::ostream& os) const
+{
+    class exMan {
+      std::ios::iostate const orig;
+      protocol::ostream& os;
+     public:
+      explicit exMan(protocol::ostream& s) : orig(s.exceptions()), os(s)
+      {
+        os.exceptions(std::ios::failbit | std::ios::badbit);
+        std::noskipws(os);
+      }
+	   ~exMan() { os.exceptions(orig); }
+    } em(os);
+
+    os << "SDD\x02\x51\x03";
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(20),
+	    static_cast<protocol::byte>(-74),
+	    static_cast<protocol::byte>(5),
+	    static_cast<protocol::byte>(-22),
+	    static_cast<protocol::byte>(96)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(-123),
+	    static_cast<protocol::byte>(-95)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    protocol::broadcast::marshal(os, *this);
+}
+
+static void marshal(protocol::ostream& os, request::slicing const& v)
+{
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(81),
+	    static_cast<protocol::byte>(2)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(124),
+	    static_cast<protocol::byte>(27)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.slices);
+}
+
+void request::slicing::marshal(protocol::ostream& os) const
+{
+    class exMan {
+      std::ios::iostate const orig;
+      protocol::ostream& os;
+     public:
+      explicit exMan(protocol::ostream& s) : orig(s.exceptions()), os(s)
+      {
+        os.exceptions(std::ios::failbit | std::ios::badbit);
+        std::noskipws(os);
+      }
+	   ~exMan() { os.exceptions(orig); }
+    } em(os);
+
+    os << "SDD\x02\x51\x03";
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(20),
+	    static_cast<protocol::byte>(-74),
+	    static_cast<protocol::byte>(5),
+	    static_cast<protocol::byte>(-22),
+	    static_cast<protocol::byte>(96)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(42),
+	    static_cast<protocol::byte>(-118)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    protocol::broadcast::marshal(os, *this);
+}
+
+static void marshal(protocol::ostream& os, request::progressive const& v)
+{
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(81),
+	    static_cast<protocol::byte>(2)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(52),
+	    static_cast<protocol::byte>(108)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.preview_scale);
+}
+
+void request::progressive::marshal(protocol::ostream& os) const
+{
+    class exMan {
+      std::ios::iostate const orig;
+      protocol::ostream& os;
+     public:
+      explicit exMan(protocol::ostream& s) : orig(s.exceptions()), os(s)
+      {
+        os.exceptions(std::ios::failbit | std::ios::badbit);
+        std::noskipws(os);
+      }
+	   ~exMan() { os.exceptions(orig); }
+    } em(os);
+
+    os << "SDD\x02\x51\x03";
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(20),
+	    static_cast<protocol::byte>(-74),
+	    static_cast<protocol::byte>(5),
+	    static_cast<protocol::byte>(-22),
+	    static_cast<protocol::byte>(96)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(41),
+	    static_cast<protocol::byte>(1)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    protocol::broadcast::marshal(os, *this);
+}
+
+static void marshal(protocol::ostream& os, request::foveation const& v)
+{
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(81),
+	    static_cast<protocol::byte>(6)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(-25),
+	    static_cast<protocol::byte>(101)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.eyes);
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(-74),
+	    static_cast<protocol::byte>(100)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.fovea_percent);
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(60),
+	    static_cast<protocol::byte>(-52)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.periphery_scale);
+}
+
+void request::foveation::marshal(protocol::ostream& os) const
+{
+    class exMan {
+      std::ios::iostate const orig;
+      protocol::ostream& os;
+     public:
+      explicit exMan(protocol::ostream& s) : orig(s.exceptions()), os(s)
+      {
+        os.exceptions(std::ios::failbit | std::ios::badbit);
+        std::noskipws(os);
+      }
+	   ~exMan() { os.exceptions(orig); }
+    } em(os);
+
+    os << "SDD\x02\x51\x03";
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(20),
+	    static_cast<protocol::byte>(-74),
+	    static_cast<protocol::byte>(5),
+	    static_cast<protocol::byte>(-22),
+	    static_cast<protocol::byte>(96)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(22),
+	    static_cast<protocol::byte>(-3)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    protocol::broadcast::marshal(os, *this);
+}
+
+static void marshal(protocol::ostream& os, request::stereo const& v)
+{
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(81),
+	    static_cast<protocol::byte>(2)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(4),
+	    static_cast<protocol::byte>(-107)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.layout);
+}
+
+void request::stereo::marshal(protocol::ostream& os) const
+{
+    class exMan {
+      std::ios::iostate const orig;
+      protocol::ostream& os;
+     public:
+      explicit exMan(protocol::ostream& s) : orig(s.exceptions()), os(s)
+      {
+        os.exceptions(std::ios::failbit | std::ios::badbit);
+        std::noskipws(os);
+      }
+	   ~exMan() { os.exceptions(orig); }
+    } em(os);
+
+    os << "SDD\x02\x51\x03";
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(20),
+	    static_cast<protocol::byte>(-74),
+	    static_cast<protocol::byte>(5),
+	    static_cast<protocol::byte>(-22),
+	    static_cast<protocol::byte>(96)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(47),
+	    static_cast<protocol::byte>(22)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    protocol::broadcast::marshal(os, *this);
+}
+
+static void marshal(protocol::ostream& os, request::pose const& v)
+{
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(81),
+	    static_cast<protocol::byte>(14)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(-104),
+	    static_cast<protocol::byte>(-68)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.timestamp_ns);
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(-90),
+	    static_cast<protocol::byte>(68)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.yaw);
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(-73),
+	    static_cast<protocol::byte>(-97)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.pitch);
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(-122),
+	    static_cast<protocol::byte>(77)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.fov_x);
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(96),
+	    static_cast<protocol::byte>(-119)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.fov_y);
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(79),
+	    static_cast<protocol::byte>(113)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.view_w);
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(-62),
+	    static_cast<protocol::byte>(-69)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.view_h);
+}
+
+void request::pose::marshal(protocol::ostream& os) const
+{
+    class exMan {
+      std::ios::iostate const orig;
+      protocol::ostream& os;
+     public:
+      explicit exMan(protocol::ostream& s) : orig(s.exceptions()), os(s)
+      {
+        os.exceptions(std::ios::failbit | std::ios::badbit);
+        std::noskipws(os);
+      }
+	   ~exMan() { os.exceptions(orig); }
+    } em(os);
+
+    os << "SDD\x02\x51\x03";
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(20),
+	    static_cast<protocol::byte>(-74),
+	    static_cast<protocol::byte>(5),
+	    static_cast<protocol::byte>(-22),
+	    static_cast<protocol::byte>(96)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(68),
+	    static_cast<protocol::byte>(-115)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    protocol::broadcast::marshal(os, *this);
+}
+
+static void marshal(protocol::ostream& os, reply::Error const& v)
+{
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(81),
+	    static_cast<protocol::byte>(4)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(103),
+	    static_cast<protocol::byte>(-108)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.code);
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(49),
+	    static_cast<protocol::byte>(2)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.message);
+}
+
+void reply::Error::marshal(protocol::ostream& os) const
+{
+    class exMan {
+      std::ios::iostate const orig;
+      protocol::ostream& os;
+     public:
+      explicit exMan(protocol::ostream& s) : orig(s.exceptions()), os(s)
+      {
+        os.exceptions(std::ios::failbit | std::ios::badbit);
+        std::noskipws(os);
+      }
+	   ~exMan() { os.exceptions(orig); }
+    } em(os);
+
+    os << "SDD\x02\x51\x03";
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(20),
+	    static_cast<protocol::byte>(-74),
+	    static_cast<protocol::byte>(5),
+	    static_cast<protocol::byte>(-22),
+	    static_cast<protocol::byte>(96)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(-44),
+	    static_cast<protocol::byte>(-23)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    protocol::broadcast::marshal(os, *this);
+}
+
+static void marshal(protocol::ostream& os, reply::connected const& v)
+{
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(81),
+	    static_cast<protocol::byte>(2)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(-16),
+	    static_cast<protocol::byte>(-49)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.server_version);
+}
+
+void reply::connected::marshal(protocol::ostream& os) const
+{
+    class exMan {
+      std::ios::iostate const orig;
+      protocol::ostream& os;
+     public:
+      explicit exMan(protocol::ostream& s) : orig(s.exceptions()), os(s)
+      {
+        os.exceptions(std::ios::failbit | std::ios::badbit);
+        std::noskipws(os);
+      }
+	   ~exMan() { os.exceptions(orig); }
+    } em(os);
+
+    os << "SDD\x02\x51\x03";
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(20),
+	    static_cast<protocol::byte>(-74),
+	    static_cast<protocol::byte>(5),
+	    static_cast<protocol::byte>(-22),
+	    static_cast<protocol::byte>(96)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(-128),
+	    static_cast<protocol::byte>(-126)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    protocol::broadcast::marshal(os, *this);
+}
+
+static void marshal(protocol::ostream& os, reply::frame const& v)
+{
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(81),
+	    static_cast<protocol::byte>(10)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(-104),
+	    static_cast<protocol::byte>(-68)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.timestamp_ns);
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(104),
+	    static_cast<protocol::byte>(-42)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.flags);
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(1),
+	    static_cast<protocol::byte>(-122)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.w);
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(-61),
+	    static_cast<protocol::byte>(-112)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.h);
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(127),
+	    static_cast<protocol::byte>(56)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.data);
+}
+
+void reply::frame::marshal(protocol::ostream& os) const
+{
+    class exMan {
+      std::ios::iostate const orig;
+      protocol::ostream& os;
+     public:
+      explicit exMan(protocol::ostream& s) : orig(s.exceptions()), os(s)
+      {
+        os.exceptions(std::ios::failbit | std::ios::badbit);
+        std::noskipws(os);
+      }
+	   ~exMan() { os.exceptions(orig); }
+    } em(os);
+
+    os << "SDD\x02\x51\x03";
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(20),
+	    static_cast<protocol::byte>(-74),
+	    static_cast<protocol::byte>(5),
+	    static_cast<protocol::byte>(-22),
+	    static_cast<protocol::byte>(96)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(-127),
+	    static_cast<protocol::byte>(-117)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    protocol::broadcast::marshal(os, *this);
+}
+
+static void marshal(protocol::ostream& os, reply::tick const& v)
+{
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(81),
+	    static_cast<protocol::byte>(2)
+	};
 
-	 default:
-	    throw std::runtime_error("found unknown field");
-	}
+	os.write(data, sizeof(data));
     }
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(-104),
+	    static_cast<protocol::byte>(-68)
+	};
 
-    if (flg != 0x3)
-	throw std::runtime_error("missing required field(s) while unmarshalling 'reply::Error' type");
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.timestamp_ns);
 }
 
-static void unmarshal(protocol::istream& is, reply::connected& v)
+void reply::tick::marshal(protocol::ostream& os) const
 {
-    uint32_t flg = 0;
-    size_t const total = readLength(is, 0x50);
+    class exMan {
+      std::ios::iostate const orig;
+      protocol::ostream& os;
+     public:
+      explicit exMan(protocol::ostream& s) : orig(s.exceptions()), os(s)
+      {
+        os.exceptions(std::ios::failbit | std::ios::badbit);
+        std::noskipws(os);
+      }
+	   ~exMan() { os.exceptions(orig); }
+    } em(os);
 
-    for (size_t ii = 0; ii < total; ii += 2) {
-	switch (readFieldLabel(is, 0x10)) {
-	 case -3889:
-	    unmarshal(is, v.server_version);
-	    flg |= 0x1;
-	    break;
+    os << "SDD\x02\x51\x03";
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(20),
+	    static_cast<protocol::byte>(-74),
+	    static_cast<protocol::byte>(5),
+	    static_cast<protocol::byte>(-22),
+	    static_cast<protocol::byte>(96)
+	};
 
-	 default:
-	    throw std::runtime_error("found unknown field");
-	}
+	os.write(data, sizeof(data));
     }
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(39),
+	    static_cast<protocol::byte>(74)
+	};
 
-    if (flg != 0x1)
-	throw std::runtime_error("missing required field(s) while unmarshalling 'reply::connected' type");
+	os.write(data, sizeof(data));
+    }
+    protocol::broadcast::marshal(os, *this);
 }
 
-static void unmarshal(protocol::istream& is, reply::frame& v)
+static void marshal(protocol::ostream& os, reply::cursor_shape const& v)
 {
-    uint32_t flg = 0;
-    size_t const total = readLength(is, 0x50);
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(81),
+	    static_cast<protocol::byte>(12)
+	};
 
-    for (size_t ii = 0; ii < total; ii += 2) {
-	switch (readFieldLabel(is, 0x10)) {
-	 case -26436:
-	    unmarshal(is, v.timestamp_ns);
-	    flg |= 0x1;
-	    break;
+	os.write(data, sizeof(data));
+    }
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(107),
+	    static_cast<protocol::byte>(36)
+	};
 
-	 case 26838:
-	    unmarshal(is, v.flags);
-	    flg |= 0x2;
-	    break;
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.serial);
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(67),
+	    static_cast<protocol::byte>(-126)
+	};
 
-	 case 390:
-	    unmarshal(is, v.w);
-	    flg |= 0x4;
-	    break;
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.hot_x);
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(-124),
+	    static_cast<protocol::byte>(-76)
+	};
 
-	 case -15472:
-	    unmarshal(is, v.h);
-	    flg |= 0x8;
-	    break;
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.hot_y);
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(1),
+	    static_cast<protocol::byte>(-122)
+	};
 
-	 case 32568:
-	    unmarshal(is, v.data);
-	    flg |= 0x10;
-	    break;
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.w);
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(-61),
+	    static_cast<protocol::byte>(-112)
+	};
 
-	 default:
-	    throw std::runtime_error("found unknown field");
-	}
+	os.write(data, sizeof(data));
     }
+    marshal(os, v.h);
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(127),
+	    static_cast<protocol::byte>(56)
+	};
 
-    if (flg != 0x1f)
-	throw std::runtime_error("missing required field(s) while unmarshalling 'reply::frame' type");
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.data);
 }
 
-static void marshal(protocol::ostream& os, request::connect const& v)
+void reply::cursor_shape::marshal(protocol::ostream& os) const
 {
+    class exMan {
+      std::ios::iostate const orig;
+      protocol::ostream& os;
+     public:
+      explicit exMan(protocol::ostream& s) : orig(s.exceptions()), os(s)
+      {
+        os.exceptions(std::ios::failbit | std::ios::badbit);
+        std::noskipws(os);
+      }
+	   ~exMan() { os.exceptions(orig); }
+    } em(os);
+
+    os << "SDD\x02\x51\x03";
     {
 	static protocol::byte const data[] = {
-	    static_cast<protocol::byte>(81),
-	    static_cast<protocol::byte>(8)
+	    static_cast<protocol::byte>(20),
+	    static_cast<protocol::byte>(-74),
+	    static_cast<protocol::byte>(5),
+	    static_cast<protocol::byte>(-22),
+	    static_cast<protocol::byte>(96)
 	};
 
 	os.write(data, sizeof(data));
@@ -370,46 +2184,58 @@ static void marshal(protocol::ostream& os, request::connect const& v)
     {
 	static protocol::byte const data[] = {
 	    static_cast<protocol::byte>(18),
-	    static_cast<protocol::byte>(26),
-	    static_cast<protocol::byte>(-81)
+	    static_cast<protocol::byte>(71),
+	    static_cast<protocol::byte>(-14)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    protocol::broadcast::marshal(os, *this);
+}
+
+static void marshal(protocol::ostream& os, reply::cursor_pos const& v)
+{
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(81),
+	    static_cast<protocol::byte>(6)
 	};
 
 	os.write(data, sizeof(data));
     }
-    marshal(os, v.version_client);
     {
 	static protocol::byte const data[] = {
 	    static_cast<protocol::byte>(18),
-	    static_cast<protocol::byte>(-126),
-	    static_cast<protocol::byte>(-7)
+	    static_cast<protocol::byte>(107),
+	    static_cast<protocol::byte>(36)
 	};
 
 	os.write(data, sizeof(data));
     }
-    marshal(os, v.screen_width);
+    marshal(os, v.serial);
     {
 	static protocol::byte const data[] = {
 	    static_cast<protocol::byte>(18),
-	    static_cast<protocol::byte>(4),
-	    static_cast<protocol::byte>(110)
+	    static_cast<protocol::byte>(-28),
+	    static_cast<protocol::byte>(97)
 	};
 
 	os.write(data, sizeof(data));
     }
-    marshal(os, v.screen_height);
+    marshal(os, v.x);
     {
 	static protocol::byte const data[] = {
 	    static_cast<protocol::byte>(18),
-	    static_cast<protocol::byte>(82),
-	    static_cast<protocol::byte>(-59)
+	    static_cast<protocol::byte>(-112),
+	    static_cast<protocol::byte>(118)
 	};
 
 	os.write(data, sizeof(data));
     }
-    marshal(os, v.win_caption);
+    marshal(os, v.y);
 }
 
-void request::connect::marshal(protocol::ostream& os) const
+void reply::cursor_pos::marshal(protocol::ostream& os) const
 {
     class exMan {
       std::ios::iostate const orig;
@@ -438,8 +2264,8 @@ void request::connect::marshal(protocol::ostream& os) const
     {
 	static protocol::byte const data[] = {
 	    static_cast<protocol::byte>(18),
-	    static_cast<protocol::byte>(54),
-	    static_cast<protocol::byte>(55)
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(119)
 	};
 
 	os.write(data, sizeof(data));
@@ -447,12 +2273,12 @@ void request::connect::marshal(protocol::ostream& os) const
     protocol::broadcast::marshal(os, *this);
 }
 
-static void marshal(protocol::ostream& os, reply::Error const& v)
+static void marshal(protocol::ostream& os, reply::chunk const& v)
 {
     {
 	static protocol::byte const data[] = {
 	    static_cast<protocol::byte>(81),
-	    static_cast<protocol::byte>(4)
+	    static_cast<protocol::byte>(6)
 	};
 
 	os.write(data, sizeof(data));
@@ -460,26 +2286,36 @@ static void marshal(protocol::ostream& os, reply::Error const& v)
     {
 	static protocol::byte const data[] = {
 	    static_cast<protocol::byte>(18),
-	    static_cast<protocol::byte>(103),
-	    static_cast<protocol::byte>(-108)
+	    static_cast<protocol::byte>(-63),
+	    static_cast<protocol::byte>(87)
 	};
 
 	os.write(data, sizeof(data));
     }
-    marshal(os, v.code);
+    marshal(os, v.offset);
     {
 	static protocol::byte const data[] = {
 	    static_cast<protocol::byte>(18),
-	    static_cast<protocol::byte>(49),
-	    static_cast<protocol::byte>(2)
+	    static_cast<protocol::byte>(75),
+	    static_cast<protocol::byte>(68)
 	};
 
 	os.write(data, sizeof(data));
     }
-    marshal(os, v.message);
+    marshal(os, v.total);
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(127),
+	    static_cast<protocol::byte>(56)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.data);
 }
 
-void reply::Error::marshal(protocol::ostream& os) const
+void reply::chunk::marshal(protocol::ostream& os) const
 {
     class exMan {
       std::ios::iostate const orig;
@@ -508,8 +2344,8 @@ void reply::Error::marshal(protocol::ostream& os) const
     {
 	static protocol::byte const data[] = {
 	    static_cast<protocol::byte>(18),
-	    static_cast<protocol::byte>(-44),
-	    static_cast<protocol::byte>(-23)
+	    static_cast<protocol::byte>(-79),
+	    static_cast<protocol::byte>(-4)
 	};
 
 	os.write(data, sizeof(data));
@@ -517,12 +2353,12 @@ void reply::Error::marshal(protocol::ostream& os) const
     protocol::broadcast::marshal(os, *this);
 }
 
-static void marshal(protocol::ostream& os, reply::connected const& v)
+static void marshal(protocol::ostream& os, reply::pipeline const& v)
 {
     {
 	static protocol::byte const data[] = {
 	    static_cast<protocol::byte>(81),
-	    static_cast<protocol::byte>(2)
+	    static_cast<protocol::byte>(6)
 	};
 
 	os.write(data, sizeof(data));
@@ -530,16 +2366,36 @@ static void marshal(protocol::ostream& os, reply::connected const& v)
     {
 	static protocol::byte const data[] = {
 	    static_cast<protocol::byte>(18),
-	    static_cast<protocol::byte>(-16),
-	    static_cast<protocol::byte>(-49)
+	    static_cast<protocol::byte>(-53),
+	    static_cast<protocol::byte>(100)
 	};
 
 	os.write(data, sizeof(data));
     }
-    marshal(os, v.server_version);
+    marshal(os, v.codec);
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(100),
+	    static_cast<protocol::byte>(71)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.lossless_codec);
+    {
+	static protocol::byte const data[] = {
+	    static_cast<protocol::byte>(18),
+	    static_cast<protocol::byte>(-112),
+	    static_cast<protocol::byte>(115)
+	};
+
+	os.write(data, sizeof(data));
+    }
+    marshal(os, v.max_fps);
 }
 
-void reply::connected::marshal(protocol::ostream& os) const
+void reply::pipeline::marshal(protocol::ostream& os) const
 {
     class exMan {
       std::ios::iostate const orig;
@@ -568,8 +2424,8 @@ void reply::connected::marshal(protocol::ostream& os) const
     {
 	static protocol::byte const data[] = {
 	    static_cast<protocol::byte>(18),
-	    static_cast<protocol::byte>(-128),
-	    static_cast<protocol::byte>(-126)
+	    static_cast<protocol::byte>(-109),
+	    static_cast<protocol::byte>(-31)
 	};
 
 	os.write(data, sizeof(data));
@@ -577,12 +2433,12 @@ void reply::connected::marshal(protocol::ostream& os) const
     protocol::broadcast::marshal(os, *this);
 }
 
-static void marshal(protocol::ostream& os, reply::frame const& v)
+static void marshal(protocol::ostream& os, reply::viewport const& v)
 {
     {
 	static protocol::byte const data[] = {
 	    static_cast<protocol::byte>(81),
-	    static_cast<protocol::byte>(10)
+	    static_cast<protocol::byte>(8)
 	};
 
 	os.write(data, sizeof(data));
@@ -600,46 +2456,36 @@ static void marshal(protocol::ostream& os, reply::frame const& v)
     {
 	static protocol::byte const data[] = {
 	    static_cast<protocol::byte>(18),
-	    static_cast<protocol::byte>(104),
-	    static_cast<protocol::byte>(-42)
-	};
-
-	os.write(data, sizeof(data));
-    }
-    marshal(os, v.flags);
-    {
-	static protocol::byte const data[] = {
-	    static_cast<protocol::byte>(18),
-	    static_cast<protocol::byte>(1),
-	    static_cast<protocol::byte>(-122)
+	    static_cast<protocol::byte>(12),
+	    static_cast<protocol::byte>(96)
 	};
 
 	os.write(data, sizeof(data));
     }
-    marshal(os, v.w);
+    marshal(os, v.pose_timestamp_ns);
     {
 	static protocol::byte const data[] = {
 	    static_cast<protocol::byte>(18),
-	    static_cast<protocol::byte>(-61),
-	    static_cast<protocol::byte>(-112)
+	    static_cast<protocol::byte>(-28),
+	    static_cast<protocol::byte>(97)
 	};
 
 	os.write(data, sizeof(data));
     }
-    marshal(os, v.h);
+    marshal(os, v.x);
     {
 	static protocol::byte const data[] = {
 	    static_cast<protocol::byte>(18),
-	    static_cast<protocol::byte>(127),
-	    static_cast<protocol::byte>(56)
+	    static_cast<protocol::byte>(-112),
+	    static_cast<protocol::byte>(118)
 	};
 
 	os.write(data, sizeof(data));
     }
-    marshal(os, v.data);
+    marshal(os, v.y);
 }
 
-void reply::frame::marshal(protocol::ostream& os) const
+void reply::viewport::marshal(protocol::ostream& os) const
 {
     class exMan {
       std::ios::iostate const orig;
@@ -668,8 +2514,8 @@ void reply::frame::marshal(protocol::ostream& os) const
     {
 	static protocol::byte const data[] = {
 	    static_cast<protocol::byte>(18),
-	    static_cast<protocol::byte>(-127),
-	    static_cast<protocol::byte>(-117)
+	    static_cast<protocol::byte>(73),
+	    static_cast<protocol::byte>(68)
 	};
 
 	os.write(data, sizeof(data));
@@ -698,6 +2544,219 @@ void request::connect::swap(request::connect& o) noexcept(true)
     win_caption.swap(o.win_caption);
 }
 
+void request::frame_format::deliverTo(Receiver& r)
+{
+    r.handle(*this);
+}
+
+static request::Base::Ptr request_frame_format_unmarshaller(protocol::istream& is)
+{
+    std::unique_ptr< request::frame_format > ptr(new request::frame_format);
+
+    unmarshal(is, *ptr);
+    return request::Base::Ptr(ptr.release());
+}
+
+void request::frame_format::swap(request::frame_format& o) noexcept(true)
+{
+    std::swap(codec, o.codec);
+    std::swap(quality, o.quality);
+}
+
+void request::ack::deliverTo(Receiver& r)
+{
+    r.handle(*this);
+}
+
+static request::Base::Ptr request_ack_unmarshaller(protocol::istream& is)
+{
+    std::unique_ptr< request::ack > ptr(new request::ack);
+
+    unmarshal(is, *ptr);
+    return request::Base::Ptr(ptr.release());
+}
+
+void request::ack::swap(request::ack& o) noexcept(true)
+{
+    std::swap(timestamp_ns, o.timestamp_ns);
+}
+
+void request::pixel_format::deliverTo(Receiver& r)
+{
+    r.handle(*this);
+}
+
+static request::Base::Ptr request_pixel_format_unmarshaller(protocol::istream& is)
+{
+    std::unique_ptr< request::pixel_format > ptr(new request::pixel_format);
+
+    unmarshal(is, *ptr);
+    return request::Base::Ptr(ptr.release());
+}
+
+void request::pixel_format::swap(request::pixel_format& o) noexcept(true)
+{
+    std::swap(format, o.format);
+}
+
+void request::chunking::deliverTo(Receiver& r)
+{
+    r.handle(*this);
+}
+
+static request::Base::Ptr request_chunking_unmarshaller(protocol::istream& is)
+{
+    std::unique_ptr< request::chunking > ptr(new request::chunking);
+
+    unmarshal(is, *ptr);
+    return request::Base::Ptr(ptr.release());
+}
+
+void request::chunking::swap(request::chunking& o) noexcept(true)
+{
+    std::swap(chunk_size, o.chunk_size);
+}
+
+void request::capabilities::deliverTo(Receiver& r)
+{
+    r.handle(*this);
+}
+
+static request::Base::Ptr request_capabilities_unmarshaller(protocol::istream& is)
+{
+    std::unique_ptr< request::capabilities > ptr(new request::capabilities);
+
+    unmarshal(is, *ptr);
+    return request::Base::Ptr(ptr.release());
+}
+
+void request::capabilities::swap(request::capabilities& o) noexcept(true)
+{
+    std::swap(codecs, o.codecs);
+    std::swap(pixel_formats, o.pixel_formats);
+    std::swap(max_fps, o.max_fps);
+    std::swap(decoder_threads, o.decoder_threads);
+}
+
+void request::tune::deliverTo(Receiver& r)
+{
+    r.handle(*this);
+}
+
+static request::Base::Ptr request_tune_unmarshaller(protocol::istream& is)
+{
+    std::unique_ptr< request::tune > ptr(new request::tune);
+
+    unmarshal(is, *ptr);
+    return request::Base::Ptr(ptr.release());
+}
+
+void request::tune::swap(request::tune& o) noexcept(true)
+{
+    std::swap(max_fps, o.max_fps);
+    std::swap(scale, o.scale);
+    std::swap(codec, o.codec);
+    std::swap(quality, o.quality);
+}
+
+void request::slicing::deliverTo(Receiver& r)
+{
+    r.handle(*this);
+}
+
+static request::Base::Ptr request_slicing_unmarshaller(protocol::istream& is)
+{
+    std::unique_ptr< request::slicing > ptr(new request::slicing);
+
+    unmarshal(is, *ptr);
+    return request::Base::Ptr(ptr.release());
+}
+
+void request::slicing::swap(request::slicing& o) noexcept(true)
+{
+    std::swap(slices, o.slices);
+}
+
+void request::progressive::deliverTo(Receiver& r)
+{
+    r.handle(*this);
+}
+
+static request::Base::Ptr request_progressive_unmarshaller(protocol::istream& is)
+{
+    std::unique_ptr< request::progressive > ptr(new request::progressive);
+
+    unmarshal(is, *ptr);
+    return request::Base::Ptr(ptr.release());
+}
+
+void request::progressive::swap(request::progressive& o) noexcept(true)
+{
+    std::swap(preview_scale, o.preview_scale);
+}
+
+void request::foveation::deliverTo(Receiver& r)
+{
+    r.handle(*this);
+}
+
+static request::Base::Ptr request_foveation_unmarshaller(protocol::istream& is)
+{
+    std::unique_ptr< request::foveation > ptr(new request::foveation);
+
+    unmarshal(is, *ptr);
+    return request::Base::Ptr(ptr.release());
+}
+
+void request::foveation::swap(request::foveation& o) noexcept(true)
+{
+    std::swap(eyes, o.eyes);
+    std::swap(fovea_percent, o.fovea_percent);
+    std::swap(periphery_scale, o.periphery_scale);
+}
+
+void request::stereo::deliverTo(Receiver& r)
+{
+    r.handle(*this);
+}
+
+static request::Base::Ptr request_stereo_unmarshaller(protocol::istream& is)
+{
+    std::unique_ptr< request::stereo > ptr(new request::stereo);
+
+    unmarshal(is, *ptr);
+    return request::Base::Ptr(ptr.release());
+}
+
+void request::stereo::swap(request::stereo& o) noexcept(true)
+{
+    std::swap(layout, o.layout);
+}
+
+void request::pose::deliverTo(Receiver& r)
+{
+    r.handle(*this);
+}
+
+static request::Base::Ptr request_pose_unmarshaller(protocol::istream& is)
+{
+    std::unique_ptr< request::pose > ptr(new request::pose);
+
+    unmarshal(is, *ptr);
+    return request::Base::Ptr(ptr.release());
+}
+
+void request::pose::swap(request::pose& o) noexcept(true)
+{
+    std::swap(timestamp_ns, o.timestamp_ns);
+    std::swap(yaw, o.yaw);
+    std::swap(pitch, o.pitch);
+    std::swap(fov_x, o.fov_x);
+    std::swap(fov_y, o.fov_y);
+    std::swap(view_w, o.view_w);
+    std::swap(view_h, o.view_h);
+}
+
 void reply::Error::deliverTo(Receiver& r)
 {
     r.handle(*this);
@@ -757,6 +2816,128 @@ void reply::frame::swap(reply::frame& o) noexcept(true)
     data.swap(o.data);
 }
 
+void reply::tick::deliverTo(Receiver& r)
+{
+    r.handle(*this);
+}
+
+static reply::Base::Ptr reply_tick_unmarshaller(protocol::istream& is)
+{
+    std::unique_ptr< reply::tick > ptr(new reply::tick);
+
+    unmarshal(is, *ptr);
+    return reply::Base::Ptr(ptr.release());
+}
+
+void reply::tick::swap(reply::tick& o) noexcept(true)
+{
+    std::swap(timestamp_ns, o.timestamp_ns);
+}
+
+void reply::cursor_shape::deliverTo(Receiver& r)
+{
+    r.handle(*this);
+}
+
+static reply::Base::Ptr reply_cursor_shape_unmarshaller(protocol::istream& is)
+{
+    std::unique_ptr< reply::cursor_shape > ptr(new reply::cursor_shape);
+
+    unmarshal(is, *ptr);
+    return reply::Base::Ptr(ptr.release());
+}
+
+void reply::cursor_shape::swap(reply::cursor_shape& o) noexcept(true)
+{
+    std::swap(serial, o.serial);
+    std::swap(hot_x, o.hot_x);
+    std::swap(hot_y, o.hot_y);
+    std::swap(w, o.w);
+    std::swap(h, o.h);
+    data.swap(o.data);
+}
+
+void reply::cursor_pos::deliverTo(Receiver& r)
+{
+    r.handle(*this);
+}
+
+static reply::Base::Ptr reply_cursor_pos_unmarshaller(protocol::istream& is)
+{
+    std::unique_ptr< reply::cursor_pos > ptr(new reply::cursor_pos);
+
+    unmarshal(is, *ptr);
+    return reply::Base::Ptr(ptr.release());
+}
+
+void reply::cursor_pos::swap(reply::cursor_pos& o) noexcept(true)
+{
+    std::swap(serial, o.serial);
+    std::swap(x, o.x);
+    std::swap(y, o.y);
+}
+
+void reply::chunk::deliverTo(Receiver& r)
+{
+    r.handle(*this);
+}
+
+static reply::Base::Ptr reply_chunk_unmarshaller(protocol::istream& is)
+{
+    std::unique_ptr< reply::chunk > ptr(new reply::chunk);
+
+    unmarshal(is, *ptr);
+    return reply::Base::Ptr(ptr.release());
+}
+
+void reply::chunk::swap(reply::chunk& o) noexcept(true)
+{
+    std::swap(offset, o.offset);
+    std::swap(total, o.total);
+    data.swap(o.data);
+}
+
+void reply::pipeline::deliverTo(Receiver& r)
+{
+    r.handle(*this);
+}
+
+static reply::Base::Ptr reply_pipeline_unmarshaller(protocol::istream& is)
+{
+    std::unique_ptr< reply::pipeline > ptr(new reply::pipeline);
+
+    unmarshal(is, *ptr);
+    return reply::Base::Ptr(ptr.release());
+}
+
+void reply::pipeline::swap(reply::pipeline& o) noexcept(true)
+{
+    std::swap(codec, o.codec);
+    std::swap(lossless_codec, o.lossless_codec);
+    std::swap(max_fps, o.max_fps);
+}
+
+void reply::viewport::deliverTo(Receiver& r)
+{
+    r.handle(*this);
+}
+
+static reply::Base::Ptr reply_viewport_unmarshaller(protocol::istream& is)
+{
+    std::unique_ptr< reply::viewport > ptr(new reply::viewport);
+
+    unmarshal(is, *ptr);
+    return reply::Base::Ptr(ptr.release());
+}
+
+void reply::viewport::swap(reply::viewport& o) noexcept(true)
+{
+    std::swap(timestamp_ns, o.timestamp_ns);
+    std::swap(pose_timestamp_ns, o.pose_timestamp_ns);
+    std::swap(x, o.x);
+    std::swap(y, o.y);
+}
+
 request::Base::Ptr request::Base::unmarshal(protocol::istream& is)
 {
     class exMan {
@@ -793,6 +2974,39 @@ request::Base::Ptr request::Base::unmarshal(protocol::istream& is)
      case 13879:
 	return request_connect_unmarshaller(is);
 
+     case -22613:
+	return request_frame_format_unmarshaller(is);
+
+     case 12722:
+	return request_ack_unmarshaller(is);
+
+     case -18847:
+	return request_pixel_format_unmarshaller(is);
+
+     case -30158:
+	return request_chunking_unmarshaller(is);
+
+     case 4689:
+	return request_capabilities_unmarshaller(is);
+
+     case -31327:
+	return request_tune_unmarshaller(is);
+
+     case 10890:
+	return request_slicing_unmarshaller(is);
+
+     case 10497:
+	return request_progressive_unmarshaller(is);
+
+     case 5885:
+	return request_foveation_unmarshaller(is);
+
+     case 12054:
+	return request_stereo_unmarshaller(is);
+
+     case 17549:
+	return request_pose_unmarshaller(is);
+
      default:
 	throw std::runtime_error("invalid request for 'broadcast' protocol");
     }
@@ -840,6 +3054,24 @@ reply::Base::Ptr reply::Base::unmarshal(protocol::istream& is)
      case -32373:
 	return reply_frame_unmarshaller(is);
 
+     case 10058:
+	return reply_tick_unmarshaller(is);
+
+     case 18418:
+	return reply_cursor_shape_unmarshaller(is);
+
+     case 4727:
+	return reply_cursor_pos_unmarshaller(is);
+
+     case -19972:
+	return reply_chunk_unmarshaller(is);
+
+     case -27679:
+	return reply_pipeline_unmarshaller(is);
+
+     case 18756:
+	return reply_viewport_unmarshaller(is);
+
      default:
 	throw std::runtime_error("invalid reply for 'broadcast' protocol");
     }
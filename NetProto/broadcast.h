@@ -24,11 +24,33 @@ namespace protocol {
 	    // Forward declaration of messages.
 
 	    struct connect;
+	    struct frame_format;
+	    struct ack;
+	    struct pixel_format;
+	    struct chunking;
+	    struct capabilities;
+	    struct tune;
+	    struct slicing;
+	    struct progressive;
+	    struct foveation;
+	    struct stereo;
+	    struct pose;
 
 	    class Receiver {
 	     public:
 	        virtual ~Receiver();
 		virtual void handle(connect&) = 0;
+		virtual void handle(frame_format&) = 0;
+		virtual void handle(ack&) = 0;
+		virtual void handle(pixel_format&) = 0;
+		virtual void handle(chunking&) = 0;
+		virtual void handle(capabilities&) = 0;
+		virtual void handle(tune&) = 0;
+		virtual void handle(slicing&) = 0;
+		virtual void handle(progressive&) = 0;
+		virtual void handle(foveation&) = 0;
+		virtual void handle(stereo&) = 0;
+		virtual void handle(pose&) = 0;
 	    };
 
 	    // Start of the message object hierarchy.
@@ -68,6 +90,234 @@ namespace protocol {
 		}
 	    };
 
+	    struct frame_format : public Base {
+		int32_t codec;
+		int32_t quality;
+
+		void swap(frame_format&) noexcept(true);
+		virtual void deliverTo(Receiver&);
+	     public:
+		frame_format() :
+		    codec(0), quality(0)
+		    {}
+		virtual void marshal(protocol::ostream&) const;
+		virtual bool needsReply() const { return false; };
+
+		inline int operator==(frame_format const& o) const noexcept(true)
+		{
+		    return (codec == o.codec) &&
+			(quality == o.quality);
+		}
+	    };
+
+	    struct ack : public Base {
+		int64_t timestamp_ns;
+
+		void swap(ack&) noexcept(true);
+		virtual void deliverTo(Receiver&);
+	     public:
+		ack() :
+		    timestamp_ns(0)
+		    {}
+		virtual void marshal(protocol::ostream&) const;
+		virtual bool needsReply() const { return false; };
+
+		inline int operator==(ack const& o) const noexcept(true)
+		{
+		    return (timestamp_ns == o.timestamp_ns);
+		}
+	    };
+
+	    struct pixel_format : public Base {
+		int32_t format;
+
+		void swap(pixel_format&) noexcept(true);
+		virtual void deliverTo(Receiver&);
+	     public:
+		pixel_format() :
+		    format(0)
+		    {}
+		virtual void marshal(protocol::ostream&) const;
+		virtual bool needsReply() const { return false; };
+
+		inline int operator==(pixel_format const& o) const noexcept(true)
+		{
+		    return (format == o.format);
+		}
+	    };
+
+	    struct chunking : public Base {
+		int32_t chunk_size;
+
+		void swap(chunking&) noexcept(true);
+		virtual void deliverTo(Receiver&);
+	     public:
+		chunking() :
+		    chunk_size(0)
+		    {}
+		virtual void marshal(protocol::ostream&) const;
+		virtual bool needsReply() const { return false; };
+
+		inline int operator==(chunking const& o) const noexcept(true)
+		{
+		    return (chunk_size == o.chunk_size);
+		}
+	    };
+
+	    struct capabilities : public Base {
+		int32_t codecs;
+		int32_t pixel_formats;
+		int32_t max_fps;
+		int32_t decoder_threads;
+
+		void swap(capabilities&) noexcept(true);
+		virtual void deliverTo(Receiver&);
+	     public:
+		capabilities() :
+		    codecs(0), pixel_formats(0), max_fps(0), decoder_threads(0)
+		    {}
+		virtual void marshal(protocol::ostream&) const;
+		virtual bool needsReply() const { return false; };
+
+		inline int operator==(capabilities const& o) const noexcept(true)
+		{
+		    return (codecs == o.codecs) &&
+			(pixel_formats == o.pixel_formats) &&
+			(max_fps == o.max_fps) &&
+			(decoder_threads == o.decoder_threads);
+		}
+	    };
+
+	    struct tune : public Base {
+		int32_t max_fps;
+		int32_t scale;
+		int32_t codec;
+		int32_t quality;
+
+		void swap(tune&) noexcept(true);
+		virtual void deliverTo(Receiver&);
+	     public:
+		tune() :
+		    max_fps(0), scale(0), codec(0), quality(0)
+		    {}
+		virtual void marshal(protocol::ostream&) const;
+		virtual bool needsReply() const { return false; };
+
+		inline int operator==(tune const& o) const noexcept(true)
+		{
+		    return (max_fps == o.max_fps) &&
+			(scale == o.scale) &&
+			(codec == o.codec) &&
+			(quality == o.quality);
+		}
+	    };
+
+	    struct slicing : public Base {
+		int32_t slices;
+
+		void swap(slicing&) noexcept(true);
+		virtual void deliverTo(Receiver&);
+	     public:
+		slicing() :
+		    slices(0)
+		    {}
+		virtual void marshal(protocol::ostream&) const;
+		virtual bool needsReply() const { return false; };
+
+		inline int operator==(slicing const& o) const noexcept(true)
+		{
+		    return (slices == o.slices);
+		}
+	    };
+
+	    struct progressive : public Base {
+		int32_t preview_scale;
+
+		void swap(progressive&) noexcept(true);
+		virtual void deliverTo(Receiver&);
+	     public:
+		progressive() :
+		    preview_scale(0)
+		    {}
+		virtual void marshal(protocol::ostream&) const;
+		virtual bool needsReply() const { return false; };
+
+		inline int operator==(progressive const& o) const noexcept(true)
+		{
+		    return (preview_scale == o.preview_scale);
+		}
+	    };
+
+	    struct foveation : public Base {
+		int32_t eyes;
+		int32_t fovea_percent;
+		int32_t periphery_scale;
+
+		void swap(foveation&) noexcept(true);
+		virtual void deliverTo(Receiver&);
+	     public:
+		foveation() :
+		    eyes(0), fovea_percent(0), periphery_scale(0)
+		    {}
+		virtual void marshal(protocol::ostream&) const;
+		virtual bool needsReply() const { return false; };
+
+		inline int operator==(foveation const& o) const noexcept(true)
+		{
+		    return (eyes == o.eyes) &&
+			(fovea_percent == o.fovea_percent) &&
+			(periphery_scale == o.periphery_scale);
+		}
+	    };
+
+	    struct stereo : public Base {
+		int32_t layout;
+
+		void swap(stereo&) noexcept(true);
+		virtual void deliverTo(Receiver&);
+	     public:
+		stereo() :
+		    layout(0)
+		    {}
+		virtual void marshal(protocol::ostream&) const;
+		virtual bool needsReply() const { return false; };
+
+		inline int operator==(stereo const& o) const noexcept(true)
+		{
+		    return (layout == o.layout);
+		}
+	    };
+
+	    struct pose : public Base {
+		int64_t timestamp_ns;
+		int32_t yaw;
+		int32_t pitch;
+		int32_t fov_x;
+		int32_t fov_y;
+		int32_t view_w;
+		int32_t view_h;
+
+		void swap(pose&) noexcept(true);
+		virtual void deliverTo(Receiver&);
+	     public:
+		pose() :
+		    timestamp_ns(0), yaw(0), pitch(0), fov_x(0), fov_y(0), view_w(0), view_h(0)
+		    {}
+		virtual void marshal(protocol::ostream&) const;
+		virtual bool needsReply() const { return false; };
+
+		inline int operator==(pose const& o) const noexcept(true)
+		{
+		    return (timestamp_ns == o.timestamp_ns) &&
+			(yaw == o.yaw) &&
+			(pitch == o.pitch) &&
+			(fov_x == o.fov_x) &&
+			(fov_y == o.fov_y) &&
+			(view_w == o.view_w) &&
+			(view_h == o.view_h);
+		}
+	    };
+
 	}
 	namespace reply {
 
@@ -76,6 +326,12 @@ namespace protocol {
 	    struct Error;
 	    struct connected;
 	    struct frame;
+	    struct tick;
+	    struct cursor_shape;
+	    struct cursor_pos;
+	    struct chunk;
+	    struct pipeline;
+	    struct viewport;
 
 	    class Receiver {
 	     public:
@@ -83,6 +339,12 @@ namespace protocol {
 		virtual void handle(Error&) = 0;
 		virtual void handle(connected&) = 0;
 		virtual void handle(frame&) = 0;
+		virtual void handle(tick&) = 0;
+		virtual void handle(cursor_shape&) = 0;
+		virtual void handle(cursor_pos&) = 0;
+		virtual void handle(chunk&) = 0;
+		virtual void handle(pipeline&) = 0;
+		virtual void handle(viewport&) = 0;
 	    };
 
 	    // Start of the message object hierarchy.
@@ -162,6 +424,142 @@ namespace protocol {
 		}
 	    };
 
+	    struct tick : public Base {
+		int64_t timestamp_ns;
+
+		void swap(tick&) noexcept(true);
+		virtual void deliverTo(Receiver&);
+	     public:
+		tick() :
+		    timestamp_ns(0)
+		    {}
+		virtual void marshal(protocol::ostream&) const;
+		virtual bool needsReply() const { return false; };
+
+		inline int operator==(tick const& o) const noexcept(true)
+		{
+		    return (timestamp_ns == o.timestamp_ns);
+		}
+	    };
+
+	    struct cursor_shape : public Base {
+		int64_t serial;
+		int32_t hot_x;
+		int32_t hot_y;
+		int32_t w;
+		int32_t h;
+		std::vector<uint8_t> data;
+
+		void swap(cursor_shape&) noexcept(true);
+		virtual void deliverTo(Receiver&);
+	     public:
+		cursor_shape() :
+		    serial(0), hot_x(0), hot_y(0), w(0), h(0)
+		    {}
+		virtual void marshal(protocol::ostream&) const;
+		virtual bool needsReply() const { return false; };
+
+		inline int operator==(cursor_shape const& o) const noexcept(true)
+		{
+		    return (serial == o.serial) &&
+			(hot_x == o.hot_x) &&
+			(hot_y == o.hot_y) &&
+			(w == o.w) &&
+			(h == o.h) &&
+			(data == o.data);
+		}
+	    };
+
+	    struct cursor_pos : public Base {
+		int64_t serial;
+		int32_t x;
+		int32_t y;
+
+		void swap(cursor_pos&) noexcept(true);
+		virtual void deliverTo(Receiver&);
+	     public:
+		cursor_pos() :
+		    serial(0), x(0), y(0)
+		    {}
+		virtual void marshal(protocol::ostream&) const;
+		virtual bool needsReply() const { return false; };
+
+		inline int operator==(cursor_pos const& o) const noexcept(true)
+		{
+		    return (serial == o.serial) &&
+			(x == o.x) &&
+			(y == o.y);
+		}
+	    };
+
+	    struct chunk : public Base {
+		int32_t offset;
+		int32_t total;
+		std::vector<uint8_t> data;
+
+		void swap(chunk&) noexcept(true);
+		virtual void deliverTo(Receiver&);
+	     public:
+		chunk() :
+		    offset(0), total(0)
+		    {}
+		virtual void marshal(protocol::ostream&) const;
+		virtual bool needsReply() const { return false; };
+
+		inline int operator==(chunk const& o) const noexcept(true)
+		{
+		    return (offset == o.offset) &&
+			(total == o.total) &&
+			(data == o.data);
+		}
+	    };
+
+	    struct pipeline : public Base {
+		int32_t codec;
+		int32_t lossless_codec;
+		int32_t max_fps;
+
+		void swap(pipeline&) noexcept(true);
+		virtual void deliverTo(Receiver&);
+	     public:
+		pipeline() :
+		    codec(0), lossless_codec(0), max_fps(0)
+		    {}
+		virtual void marshal(protocol::ostream&) const;
+		virtual bool needsReply() const { return false; };
+
+		inline int operator==(pipeline const& o) const noexcept(true)
+		{
+		    return (codec == o.codec) &&
+			(lossless_codec == o.lossless_codec) &&
+			(max_fps == o.max_fps);
+		}
+	    };
+
+	    struct viewport : public Base {
+		int64_t timestamp_ns;
+		int64_t pose_timestamp_ns;
+		int32_t x;
+		int32_t y;
+
+		void swap(viewport&) noexcept(true);
+		virtual void deliverTo(Receiver&);
+	     public:
+		viewport() :
+		    timestamp_ns(0), pose_timestamp_ns(0), x(0), y(0)
+		    {}
+		virtual void marshal(protocol::ostream&) const;
+		virtual bool needsReply() const { return false; };
+
+		inline int operator==(viewport const& o) const noexcept(true)
+		{
+		    return (timestamp_ns == o.timestamp_ns) &&
+			(pose_timestamp_ns == o.pose_timestamp_ns) &&
+			(x == o.x) &&
+			(y == o.y);
+		}
+	    };
+
 	}
     }
 }
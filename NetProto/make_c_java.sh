@@ -1,4 +1,6 @@
 #!/bin/bash
+# Regenerates broadcast.cpp, broadcast.h and Android broadcast.java out of broadcast.proto.
+# Generated files must never be edited by hand: change broadcast.proto, run this and commit all of them together.
 
 function message_abort {
   echo >&2 "You need to compile and install proto compiler: https://github.com/alexzk1/protocol-compiler"; exit 1;
@@ -7,23 +9,25 @@ function message_abort {
 function test_pc {
    command -v pc >/dev/null 2>&1 || { message_abort; }
    local tmp=$(pc -V)
-   if [[ $tmp != *"pc version:"* ]]; then         
+   if [[ $tmp != *"pc version:"* ]]; then
       message_abort
    fi
 }
 
-ANDR_FOLDER="../Client/core/src/biz/an_droid/br_client/proto"
+set -e
+cd "$(dirname "$0")"
 
-rm broadcast.cpp
-rm broadcast.h
-rm $ANDR_FOLDER/broadcast.java
+ANDR_FOLDER="../Client/core/src/biz/an_droid/br_client/proto"
 
+#old files are kept when there is nothing to generate new ones with
 test_pc
 echo 'Going to compile network protocol'
 
+rm -f broadcast.cpp broadcast.h $ANDR_FOLDER/broadcast.java
+
 pc -l c++ --c++-17 broadcast.proto
 pc -l java --java-use-pkg biz.an_droid.br_client.proto broadcast.proto
 
 mv ./broadcast.java $ANDR_FOLDER
 
-echo 'Network protocol is compiled'
\ No newline at end of file
+echo 'Network protocol is compiled'
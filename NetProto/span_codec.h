@@ -0,0 +1,499 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "broadcast.h"
+
+//Zero-copy alternative to iostream based (un)marshal of broadcast.h messages, same wire format:
+//"SDD" 2, then struct of 3 items: protocol id, message id, message struct.
+//Each value is tag byte (type in high nibble, size 1..8 in low nibble) followed by big endian signed integer;
+//string and binary are such length followed by bytes, struct is count of items (label + value per field).
+//Fields may come in any order.
+namespace protocol
+{
+    namespace span
+    {
+        enum class Tag : uint8_t
+        {
+            Int    = 0x10,
+            Binary = 0x30,
+            String = 0x40,
+            Struct = 0x50,
+        };
+
+        //view into buffer, valid while buffer is
+        struct Bytes
+        {
+            const uint8_t* data{nullptr};
+            size_t size{0};
+
+            std::string str() const
+            {
+                return std::string(reinterpret_cast<const char*>(data), size);
+            }
+        };
+
+        struct Field
+        {
+            int16_t label{0};
+            Tag tag{Tag::Int};
+            int64_t value{0};
+            Bytes bytes;
+        };
+
+        enum class Status
+        {
+            Complete,
+            Incomplete, //buffer holds beginning of message only
+            Malformed,
+        };
+
+        //parsed message, binary and string fields point into source buffer
+        struct MessageView
+        {
+            constexpr static size_t MAX_FIELDS = 16;
+
+            int16_t id{0};
+            size_t size{0}; //bytes taken by whole message
+            size_t count{0};
+            Field fields[MAX_FIELDS];
+
+            const Field* find(int16_t label, Tag tag) const
+            {
+                for (size_t i = 0; i < count; ++i)
+                    if (fields[i].label == label && fields[i].tag == tag)
+                        return fields + i;
+                return nullptr;
+            }
+
+            template <class T>
+            bool get(int16_t label, T& v) const
+            {
+                const auto f = find(label, Tag::Int);
+                if (!f || f->value < static_cast<int64_t>(std::numeric_limits<T>::min()) ||
+                        f->value > static_cast<int64_t>(std::numeric_limits<T>::max()))
+                    return false;
+                v = static_cast<T>(f->value);
+                return true;
+            }
+
+            bool get(int16_t label, std::string& v) const
+            {
+                const auto f = find(label, Tag::String);
+                if (f)
+                    v = f->bytes.str();
+                return f != nullptr;
+            }
+
+            bool get(int16_t label, Bytes& v) const
+            {
+                const auto f = find(label, Tag::Binary);
+                if (f)
+                    v = f->bytes;
+                return f != nullptr;
+            }
+        };
+
+        class Reader
+        {
+        private:
+            const uint8_t* p;
+            const uint8_t* end;
+        public:
+            Reader(const uint8_t* data, size_t size): p(data), end(data + size) {}
+
+            size_t offset(const uint8_t* start) const
+            {
+                return static_cast<size_t>(p - start);
+            }
+
+            Status readInt(Tag tag, int64_t& v)
+            {
+                if (p >= end)
+                    return Status::Incomplete;
+                const int len = *p & 0x0F;
+                if ((*p & 0xF0) != static_cast<uint8_t>(tag) || len < 1 || len > 8)
+                    return Status::Malformed;
+                if (end - p < len + 1)
+                    return Status::Incomplete;
+                ++p;
+                //sign extended big endian
+                uint64_t u = (*p & 0x80) ? ~0ull : 0ull;
+                for (int i = 0; i < len; ++i)
+                    u = (u << 8) | *p++;
+                v = static_cast<int64_t>(u);
+                return Status::Complete;
+            }
+
+            Status readLength(Tag tag, size_t& len)
+            {
+                int64_t v;
+                const auto s = readInt(tag, v);
+                if (s != Status::Complete)
+                    return s;
+                if (v < 0 || v > 0x7FFFFFFF)
+                    return Status::Malformed;
+                len = static_cast<size_t>(v);
+                return Status::Complete;
+            }
+
+            Status readBytes(Tag tag, Bytes& b)
+            {
+                size_t len;
+                const auto s = readLength(tag, len);
+                if (s != Status::Complete)
+                    return s;
+                if (static_cast<size_t>(end - p) < len)
+                    return Status::Incomplete;
+                b.data = p;
+                b.size = len;
+                p += len;
+                return Status::Complete;
+            }
+
+            //any value of the field, nested structs and arrays are not used by broadcast protocol
+            Status readValue(Field& f)
+            {
+                if (p >= end)
+                    return Status::Incomplete;
+                f.tag = static_cast<Tag>(*p & 0xF0);
+                switch (f.tag)
+                {
+                    case Tag::Int:
+                        return readInt(Tag::Int, f.value);
+                    case Tag::Binary:
+                    case Tag::String:
+                        return readBytes(f.tag, f.bytes);
+                    default:
+                        return Status::Malformed;
+                }
+            }
+        };
+
+        //protocol id as generated code writes it, same way as messageId() below
+        inline int32_t protocolId()
+        {
+            static const int32_t id = []()
+            {
+                std::ostringstream os;
+                broadcast::request::ack().marshal(os);
+                const auto bytes = os.str();
+                if (bytes.size() < 4)
+                    return int32_t{0};
+                Reader r(reinterpret_cast<const uint8_t*>(bytes.data()) + 4, bytes.size() - 4);
+                size_t items;
+                int64_t v;
+                if (r.readLength(Tag::Struct, items) != Status::Complete || r.readInt(Tag::Int, v) != Status::Complete)
+                    return int32_t{0};
+                return static_cast<int32_t>(v);
+            }();
+            return id;
+        }
+
+        //parses single message at the start of buffer
+        inline Status parse(const uint8_t* data, size_t size, MessageView& msg)
+        {
+#define SPAN_CHECK(EXPR) do { const auto s_ = (EXPR); if (s_ != Status::Complete) return s_; } while (0)
+            if (size < 4)
+                return (std::memcmp(data, "SDD\x02", size)) ? Status::Malformed : Status::Incomplete;
+            if (std::memcmp(data, "SDD\x02", 4))
+                return Status::Malformed;
+
+            Reader r(data + 4, size - 4);
+            size_t items;
+            int64_t v;
+            SPAN_CHECK(r.readLength(Tag::Struct, items));
+            if (items != 3)
+                return Status::Malformed;
+            SPAN_CHECK(r.readInt(Tag::Int, v));
+            if (v != protocolId())
+                return Status::Malformed;
+            SPAN_CHECK(r.readInt(Tag::Int, v));
+            msg.id = static_cast<int16_t>(v);
+
+            SPAN_CHECK(r.readLength(Tag::Struct, items));
+            if (items % 2 || items / 2 > MessageView::MAX_FIELDS)
+                return Status::Malformed;
+            msg.count = items / 2;
+            for (size_t i = 0; i < msg.count; ++i)
+            {
+                auto& f = msg.fields[i];
+                SPAN_CHECK(r.readInt(Tag::Int, v));
+                f.label = static_cast<int16_t>(v);
+                SPAN_CHECK(r.readValue(f));
+            }
+            msg.size = 4 + r.offset(data + 4);
+            return Status::Complete;
+#undef SPAN_CHECK
+        }
+
+        namespace detail
+        {
+            template <class Member>
+            struct MemberOf;
+
+            template <class Message, class T>
+            struct MemberOf<T Message::*>
+            {
+                using Type = Message;
+            };
+
+            //probe value of the field which label is looked for, other fields stay 0 / empty
+            constexpr static int32_t MARKER = 0x5A17E1;
+            constexpr static uint8_t MARKER_BYTES[] = {0x5A, 0x17, 0xE1};
+
+            template <class T>
+            void setMarker(T& v)
+            {
+                v = MARKER;
+            }
+
+            inline void setMarker(std::string& v)
+            {
+                v.assign(std::begin(MARKER_BYTES), std::end(MARKER_BYTES));
+            }
+
+            inline void setMarker(std::vector<uint8_t>& v)
+            {
+                v.assign(std::begin(MARKER_BYTES), std::end(MARKER_BYTES));
+            }
+
+            inline bool isMarker(const Field& f)
+            {
+                if (f.tag == Tag::Int)
+                    return f.value == MARKER;
+                return f.bytes.size == sizeof(MARKER_BYTES) && !std::memcmp(f.bytes.data, MARKER_BYTES, sizeof(MARKER_BYTES));
+            }
+
+            //message marshaled by generated code and parsed back, msg points into bytes
+            template <class Message>
+            bool reparse(const Message& m, std::string& bytes, MessageView& msg)
+            {
+                std::ostringstream os;
+                m.marshal(os);
+                bytes = os.str();
+                return parse(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size(), msg) == Status::Complete;
+            }
+        }
+
+        //Message ids and field labels are taken from generated code itself: probe message is marshaled by it
+        //and parsed back once, so they always match broadcast.proto. 0 means generated code wrote something
+        //this codec cannot read.
+        template <class Message>
+        int16_t messageId()
+        {
+            static const int16_t id = []()
+            {
+                std::string bytes;
+                MessageView msg;
+                return (detail::reparse(Message(), bytes, msg)) ? msg.id : int16_t{0};
+            }();
+            return id;
+        }
+
+        //label<&broadcast::reply::frame::data>()
+        template <auto Member>
+        int16_t label()
+        {
+            static const int16_t value = []()
+            {
+                typename detail::MemberOf<decltype(Member)>::Type m;
+                detail::setMarker(m.*Member);
+                std::string bytes;
+                MessageView msg;
+                if (detail::reparse(m, bytes, msg))
+                    for (size_t i = 0; i < msg.count; ++i)
+                        if (detail::isMarker(msg.fields[i]))
+                            return msg.fields[i].label;
+                return int16_t{0};
+            }();
+            return value;
+        }
+
+        namespace detail
+        {
+            //request with all listed fields, nullptr if some is missing
+            template <class Message, auto... Members>
+            broadcast::request::Base::Ptr build(const MessageView& msg)
+            {
+                std::unique_ptr<Message> r(new Message());
+                if ((msg.get(label<Members>(), (*r).*Members) && ...))
+                    return broadcast::request::Base::Ptr(r.release());
+                return nullptr;
+            }
+
+            struct RequestBuilder
+            {
+                int16_t id;
+                broadcast::request::Base::Ptr (*build)(const MessageView&);
+            };
+        }
+
+        //builds generated request object out of parsed message, nullptr if it is unknown or misses fields
+        inline broadcast::request::Base::Ptr makeRequest(const MessageView& msg)
+        {
+            using namespace broadcast::request;
+            using detail::build;
+            static const detail::RequestBuilder builders[] =
+            {
+                {messageId<connect>(), &build<connect, &connect::version_client, &connect::screen_width,
+                                              &connect::screen_height, &connect::win_caption>},
+                {messageId<frame_format>(), &build<frame_format, &frame_format::codec, &frame_format::quality>},
+                {messageId<ack>(), &build<ack, &ack::timestamp_ns>},
+                {messageId<pixel_format>(), &build<pixel_format, &pixel_format::format>},
+                {messageId<chunking>(), &build<chunking, &chunking::chunk_size>},
+                {messageId<capabilities>(), &build<capabilities, &capabilities::codecs, &capabilities::pixel_formats,
+                                                   &capabilities::max_fps, &capabilities::decoder_threads>},
+                {messageId<tune>(), &build<tune, &tune::max_fps, &tune::scale, &tune::codec, &tune::quality>},
+                {messageId<slicing>(), &build<slicing, &slicing::slices>},
+                {messageId<progressive>(), &build<progressive, &progressive::preview_scale>},
+                {messageId<foveation>(), &build<foveation, &foveation::eyes, &foveation::fovea_percent,
+                                                &foveation::periphery_scale>},
+                {messageId<stereo>(), &build<stereo, &stereo::layout>},
+                {messageId<pose>(), &build<pose, &pose::timestamp_ns, &pose::yaw, &pose::pitch, &pose::fov_x,
+                                           &pose::fov_y, &pose::view_w, &pose::view_h>},
+            };
+            for (const auto& b : builders)
+                if (b.id == msg.id)
+                    return b.build(msg);
+            return nullptr;
+        }
+
+        //resumable parser: bytes are fed as they arrive, complete messages are taken out,
+        //partial one stays buffered until the rest comes
+        class Parser
+        {
+        private:
+            const size_t max_message;
+            std::vector<uint8_t> buffer;
+            size_t start{0};
+            size_t filled{0};
+
+            //drops garbage up to the next message signature
+            void resync()
+            {
+                static const uint8_t sig[] = {'S', 'D', 'D', 2};
+                const auto first = buffer.begin() + static_cast<std::ptrdiff_t>(start) + 1;
+                const auto last = buffer.begin() + static_cast<std::ptrdiff_t>(filled);
+                const auto found = std::search(first, last, std::begin(sig), std::end(sig));
+                //tail may be beginning of the signature
+                start = (found != last) ? static_cast<size_t>(found - buffer.begin()) :
+                        std::max(start + 1, filled - std::min(filled, sizeof(sig) - 1));
+            }
+        public:
+            explicit Parser(size_t max_message): max_message(max_message) {}
+
+            //space for n more bytes, commit() tells how many were written there
+            uint8_t* prepare(size_t n)
+            {
+                if (start)
+                {
+                    std::memmove(buffer.data(), buffer.data() + start, filled - start);
+                    filled -= start;
+                    start = 0;
+                }
+                if (buffer.size() < filled + n)
+                    buffer.resize(filled + n);
+                return buffer.data() + filled;
+            }
+
+            void commit(size_t n)
+            {
+                filled += n;
+            }
+
+            //Incomplete means wait for more bytes, on Malformed bad bytes are skipped and next() can be called again;
+            //view is valid until prepare() is called
+            Status next(MessageView& msg)
+            {
+                if (start == filled)
+                    return Status::Incomplete;
+                auto s = parse(buffer.data() + start, filled - start, msg);
+                if (s == Status::Incomplete && filled - start > max_message)
+                    s = Status::Malformed;
+                if (s == Status::Complete)
+                    start += msg.size;
+                else if (s == Status::Malformed)
+                    resync();
+                return s;
+            }
+        };
+
+        //appends message to buffer which is reused between messages
+        class Writer
+        {
+        private:
+            std::vector<uint8_t>& out;
+
+            void putRaw(Tag tag, int64_t v)
+            {
+                int len = 1;
+                while (len < 8 && (v < -(1ll << (len * 8 - 1)) || v >= (1ll << (len * 8 - 1))))
+                    ++len;
+                putFixed(tag, v, len);
+            }
+
+            void putFixed(Tag tag, int64_t v, int len)
+            {
+                out.push_back(static_cast<uint8_t>(static_cast<uint8_t>(tag) + len));
+                for (int shift = (len - 1) * 8; shift >= 0; shift -= 8)
+                    out.push_back(static_cast<uint8_t>(static_cast<uint64_t>(v) >> shift));
+            }
+        public:
+            explicit Writer(std::vector<uint8_t>& out): out(out) {}
+
+            void header(int16_t message_id, size_t field_count)
+            {
+                static const uint8_t start[] = {'S', 'D', 'D', 2, 0x51, 0x03};
+                out.insert(out.end(), std::begin(start), std::end(start));
+                putRaw(Tag::Int, protocolId());
+                putRaw(Tag::Int, message_id);
+                putRaw(Tag::Struct, static_cast<int64_t>(field_count * 2));
+            }
+
+            void putInt(int16_t label, int64_t v)
+            {
+                putRaw(Tag::Int, label);
+                putRaw(Tag::Int, v);
+            }
+
+            void putString(int16_t label, const std::string& v)
+            {
+                putRaw(Tag::Int, label);
+                putRaw(Tag::String, static_cast<int64_t>(v.size()));
+                out.insert(out.end(), v.begin(), v.end());
+            }
+
+            //binary field which content is appended to the same buffer by caller,
+            //length is written with fixed size and set by endBinary()
+            size_t beginBinary(int16_t label)
+            {
+                putRaw(Tag::Int, label);
+                const size_t at = out.size();
+                putFixed(Tag::Binary, 0, 4);
+                return at;
+            }
+
+            //binary field which content of size bytes is sent separately right after the message
+            void binaryHeader(int16_t label, size_t size)
+            {
+                putRaw(Tag::Int, label);
+                putRaw(Tag::Binary, static_cast<int64_t>(size));
+            }
+
+            void endBinary(size_t at)
+            {
+                const auto len = static_cast<uint32_t>(out.size() - at - 5);
+                for (int i = 0; i < 4; ++i)
+                    out[at + 1 + i] = static_cast<uint8_t>(len >> ((3 - i) * 8));
+            }
+        };
+    }
+}
@@ -0,0 +1,276 @@
+//span_codec must read what generated code writes and write what it reads; timings of both paths are printed.
+//Non zero exit code means some check failed.
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include "span_codec.h"
+
+using namespace protocol;
+
+namespace
+{
+    int failures = 0;
+
+#define CHECK(COND) do { if (!(COND)) { ++failures; std::cout << "FAILED " << __LINE__ << ": " << #COND << std::endl; } } while (0)
+
+    double msPerRun(int runs, const std::function<void()>& f)
+    {
+        f();
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < runs; ++i)
+            f();
+        const std::chrono::duration<double, std::milli> d = std::chrono::steady_clock::now() - start;
+        return d.count() / runs;
+    }
+
+    std::string marshaled(const broadcast::request::Base& m)
+    {
+        std::ostringstream os;
+        m.marshal(os);
+        return os.str();
+    }
+
+    //generated request goes through span parser and back to generated object
+    template <class Message>
+    bool sameAfterSpan(const Message& m)
+    {
+        const auto bytes = marshaled(m);
+        span::MessageView view;
+        if (span::parse(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size(), view) != span::Status::Complete ||
+                view.size != bytes.size())
+            return false;
+        const auto r = span::makeRequest(view);
+        const auto typed = dynamic_cast<const Message*>(r.get());
+        return typed && *typed == m;
+    }
+
+    void testIds()
+    {
+        using namespace broadcast;
+        const std::set<int16_t> ids =
+        {
+            span::messageId<request::connect>(), span::messageId<request::frame_format>(), span::messageId<request::ack>(),
+            span::messageId<request::pixel_format>(), span::messageId<request::chunking>(),
+            span::messageId<request::capabilities>(), span::messageId<request::tune>(), span::messageId<request::slicing>(),
+            span::messageId<request::progressive>(), span::messageId<request::foveation>(),
+            span::messageId<request::stereo>(), span::messageId<request::pose>(),
+        };
+        CHECK(ids.size() == 12 && !ids.count(0));
+        CHECK(span::protocolId() != 0);
+        CHECK(span::messageId<reply::frame>() != 0 && span::messageId<reply::chunk>() != 0);
+        CHECK(span::messageId<reply::frame>() != span::messageId<reply::chunk>());
+
+        const std::set<int16_t> labels =
+        {
+            span::label<&reply::frame::timestamp_ns>(), span::label<&reply::frame::flags>(), span::label<&reply::frame::w>(),
+            span::label<&reply::frame::h>(), span::label<&reply::frame::data>(),
+        };
+        CHECK(labels.size() == 5 && !labels.count(0));
+        //same field name is the same label in any message
+        CHECK(span::label<&request::tune::codec>() == span::label<&request::frame_format::codec>());
+    }
+
+    void testRequests()
+    {
+        using namespace broadcast::request;
+        connect c;
+        c.version_client = 2;
+        c.screen_width = 1920;
+        c.screen_height = -1080;
+        c.win_caption = "caption";
+        CHECK(sameAfterSpan(c));
+
+        tune t;
+        t.max_fps = 60;
+        t.scale = 2;
+        t.codec = 8;
+        t.quality = 75;
+        CHECK(sameAfterSpan(t));
+
+        capabilities caps;
+        caps.codecs = 0x7FFFFFFF;
+        caps.pixel_formats = 31;
+        caps.max_fps = 90;
+        caps.decoder_threads = 4;
+        CHECK(sameAfterSpan(caps));
+
+        pose p;
+        p.timestamp_ns = 0x123456789ABCll;
+        p.yaw = -17;
+        p.pitch = 33;
+        p.fov_x = 90;
+        p.fov_y = 90;
+        p.view_w = 1280;
+        p.view_h = 720;
+        CHECK(sameAfterSpan(p));
+
+        ack a;
+        a.timestamp_ns = -1;
+        CHECK(sameAfterSpan(a));
+        CHECK(sameAfterSpan(frame_format()));
+        CHECK(sameAfterSpan(pixel_format()));
+        CHECK(sameAfterSpan(chunking()));
+        CHECK(sameAfterSpan(slicing()));
+        CHECK(sameAfterSpan(progressive()));
+        CHECK(sameAfterSpan(foveation()));
+        CHECK(sameAfterSpan(stereo()));
+
+        //message missing a field is not built
+        std::vector<uint8_t> partial;
+        span::Writer writer(partial);
+        writer.header(span::messageId<tune>(), 1);
+        writer.putInt(span::label<&tune::codec>(), 8);
+        span::MessageView view;
+        CHECK(span::parse(partial.data(), partial.size(), view) == span::Status::Complete);
+        CHECK(!span::makeRequest(view));
+    }
+
+    //frame written by span Writer in place, read by generated unmarshal
+    void writeFrame(const broadcast::reply::frame& f, std::vector<uint8_t>& out)
+    {
+        using Frame = broadcast::reply::frame;
+        out.clear();
+        span::Writer writer(out);
+        writer.header(span::messageId<Frame>(), 5);
+        const auto at = writer.beginBinary(span::label<&Frame::data>());
+        out.insert(out.end(), f.data.begin(), f.data.end());
+        writer.endBinary(at);
+        writer.putInt(span::label<&Frame::timestamp_ns>(), f.timestamp_ns);
+        writer.putInt(span::label<&Frame::flags>(), f.flags);
+        writer.putInt(span::label<&Frame::w>(), f.w);
+        writer.putInt(span::label<&Frame::h>(), f.h);
+    }
+
+    //viewport is written by encoder with span Writer too
+    void testViewport()
+    {
+        using Viewport = broadcast::reply::viewport;
+        Viewport v;
+        v.timestamp_ns = 987654321012ll;
+        v.pose_timestamp_ns = -5;
+        v.x = 640;
+        v.y = 0;
+        std::vector<uint8_t> out;
+        span::Writer writer(out);
+        writer.header(span::messageId<Viewport>(), 4);
+        writer.putInt(span::label<&Viewport::timestamp_ns>(), v.timestamp_ns);
+        writer.putInt(span::label<&Viewport::pose_timestamp_ns>(), v.pose_timestamp_ns);
+        writer.putInt(span::label<&Viewport::x>(), v.x);
+        writer.putInt(span::label<&Viewport::y>(), v.y);
+        std::istringstream is(std::string(out.begin(), out.end()));
+        const auto r = broadcast::reply::Base::unmarshal(is);
+        const auto typed = dynamic_cast<const Viewport*>(r.get());
+        CHECK(typed && *typed == v);
+    }
+
+    void testFrame()
+    {
+        using broadcast::reply::frame;
+        frame f;
+        f.timestamp_ns = 1234567890123ll;
+        f.flags = 4 | 1;
+        f.w = 1920;
+        f.h = 1080;
+        f.data.resize(1 << 20);
+        for (size_t i = 0; i < f.data.size(); ++i)
+            f.data[i] = static_cast<uint8_t>(i * 31);
+
+        std::vector<uint8_t> packet;
+        writeFrame(f, packet);
+        std::istringstream is(std::string(packet.begin(), packet.end()));
+        const auto r = broadcast::reply::Base::unmarshal(is);
+        const auto typed = dynamic_cast<const frame*>(r.get());
+        CHECK(typed && *typed == f);
+
+        //parser takes message split at any point and skips garbage before it
+        span::Parser parser(2 << 20);
+        const uint8_t garbage[] = {'S', 'D', 1, 2, 3};
+        std::copy_n(garbage, sizeof(garbage), parser.prepare(sizeof(garbage)));
+        parser.commit(sizeof(garbage));
+        const size_t half = packet.size() / 2;
+        std::copy_n(packet.data(), half, parser.prepare(half));
+        parser.commit(half);
+        span::MessageView view;
+        auto s = parser.next(view);
+        while (s == span::Status::Malformed)
+            s = parser.next(view);
+        CHECK(s == span::Status::Incomplete);
+        std::copy_n(packet.data() + half, packet.size() - half, parser.prepare(packet.size() - half));
+        parser.commit(packet.size() - half);
+        CHECK(parser.next(view) == span::Status::Complete && view.id == span::messageId<frame>());
+        span::Bytes data;
+        CHECK(view.get(span::label<&frame::data>(), data) && data.size == f.data.size() &&
+              std::equal(f.data.begin(), f.data.end(), data.data));
+
+        //1 MB frame: marshal into reused buffer vs ostringstream, parse in place vs istream into vector
+        std::string text;
+        const double span_write = msPerRun(50, [&]()
+        {
+            writeFrame(f, packet);
+        });
+        const double stream_write = msPerRun(50, [&]()
+        {
+            std::ostringstream os;
+            f.marshal(os);
+            text = os.str();
+        });
+        const double span_read = msPerRun(50, [&]()
+        {
+            span::parse(packet.data(), packet.size(), view);
+        });
+        const double stream_read = msPerRun(50, [&]()
+        {
+            std::istringstream in(text);
+            broadcast::reply::Base::unmarshal(in);
+        });
+        std::cout << "1 MB frame write: span " << span_write << " ms, iostream " << stream_write << " ms" << std::endl;
+        std::cout << "1 MB frame read: span " << span_read << " ms, iostream " << stream_read << " ms" << std::endl;
+    }
+
+    void benchRequests()
+    {
+        broadcast::request::pose p;
+        p.timestamp_ns = 1;
+        p.view_w = 1280;
+        p.view_h = 720;
+        std::string stream;
+        for (int i = 0; i < 1000; ++i)
+            stream += marshaled(p);
+
+        const double span_ms = msPerRun(20, [&]()
+        {
+            span::Parser parser(4096);
+            std::copy(stream.begin(), stream.end(), parser.prepare(stream.size()));
+            parser.commit(stream.size());
+            span::MessageView view;
+            while (parser.next(view) == span::Status::Complete)
+                span::makeRequest(view);
+        });
+        const double stream_ms = msPerRun(20, [&]()
+        {
+            std::istringstream in(stream);
+            for (int i = 0; i < 1000; ++i)
+                broadcast::request::Base::unmarshal(in);
+        });
+        std::cout << "1000 pose requests: span " << span_ms << " ms, iostream " << stream_ms << " ms" << std::endl;
+    }
+}
+
+int main()
+{
+    testIds();
+    testRequests();
+    testViewport();
+    testFrame();
+    benchRequests();
+
+    if (failures)
+    {
+        std::cout << failures << " checks failed." << std::endl;
+        return 1;
+    }
+    std::cout << "All checks passed." << std::endl;
+    return 0;
+}
@@ -0,0 +1,14 @@
+# span_codec against generated iostream codec: same messages both ways, parse and marshal timings.
+# Run without arguments: exit code 0 means all checks passed.
+
+TEMPLATE = app
+TARGET = span_tests
+CONFIG += console c++17
+CONFIG -= qt app_bundle
+
+SOURCES += span_tests.cpp
+
+include($$PWD/../bproto.pri)
+
+QMAKE_CXXFLAGS += -std=c++17 -Wall -Werror=return-type
+CONFIG(release, debug|release): QMAKE_CXXFLAGS += -O3